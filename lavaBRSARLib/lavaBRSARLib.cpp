@@ -4,15 +4,6 @@ namespace lava
 {
 	namespace brawl
 	{
-		std::string generateVGAudioWavToDSPCommand(std::string wavFilePath, std::string outputFilePath)
-		{
-			return "\"\"" + VGAudioMainExePath + "\" -c -i:0 \"" + wavFilePath + "\" -o \"" + outputFilePath + "\"\"";
-		}
-		std::string generateVGAudioDSPToWavCommand(std::string dspFilePath, std::string outputFilePath)
-		{
-			return "\"\"" + VGAudioMainExePath + "\" -c -i \"" + dspFilePath + "\" -o \"" + outputFilePath + "\"\"";
-		}
-
 		/* Misc. */
 
 		unsigned long validateHexTag(unsigned long tagIn)
@@ -295,6 +286,35 @@ namespace lava
 
 			return result;
 		}
+		bool waveInfo::populateHeader(const std::vector<unsigned char>& bodyIn, std::size_t addressIn)
+		{
+			bool result = 0;
+
+			if (addressIn < bodyIn.size() && (addressIn + headerLength) <= bodyIn.size())
+			{
+				address = addressIn;
+
+				// Only the fixed fields are copied out of the source.
+				lava::byteArray headerArr(bodyIn.data() + address, headerLength);
+				std::size_t cursor = 0x00;
+				encoding = headerArr.getChar(cursor, &cursor);
+				looped = headerArr.getChar(cursor, &cursor);
+				channels = headerArr.getChar(cursor, &cursor);
+				sampleRate24 = headerArr.getChar(cursor, &cursor);
+				sampleRate = headerArr.getShort(cursor, &cursor);
+				dataLocationType = headerArr.getChar(cursor, &cursor);
+				pad = headerArr.getChar(cursor, &cursor);
+				loopStartSample = headerArr.getLong(cursor, &cursor);
+				nibbles = headerArr.getLong(cursor, &cursor);
+				channelInfoTableOffset = headerArr.getLong(cursor, &cursor);
+				dataLocation = headerArr.getLong(cursor, &cursor);
+				reserved = headerArr.getLong(cursor, &cursor);
+
+				result = 1;
+			}
+
+			return result;
+		}
 		bool waveInfo::exportContents(std::ostream& destinationStream)
 		{
 			bool result = 0;
@@ -333,17 +353,120 @@ namespace lava
 			}
 			return result;
 		}
+		unsigned long waveInfo::getSampleRate() const
+		{
+			return (unsigned long(sampleRate24) << 16) | sampleRate;
+		}
 		unsigned long waveInfo::getAudioLengthInBytes() const
 		{
 			unsigned long result = ULONG_MAX;
 
 			if (address != ULONG_MAX)
 			{
-				result = lava::brawl::nibblesToBytes(nibbles);
+				result = getChannelLengthInBytes();
+				// Channels are stored one after another, so the audio runs through to the end of the furthest channel.
+				for (std::size_t i = 1; i < channelInfoEntries.size(); i++)
+				{
+					unsigned long channelDataOffset = channelInfoEntries[i].channelDataOffset;
+					if (channelDataOffset != ULONG_MAX && (channelDataOffset + getChannelLengthInBytes()) > result)
+					{
+						result = channelDataOffset + getChannelLengthInBytes();
+					}
+				}
+			}
+
+			return result;
+		}
+		unsigned long waveInfo::getChannelLengthInBytes() const
+		{
+			return lava::brawl::nibblesToBytes(nibbles);
+		}
+		bool waveInfo::getChannelData(unsigned long channelIndex, std::vector<unsigned char>& dataOut) const
+		{
+			bool result = 0;
+
+			dataOut.clear();
+			if (channelIndex < channelInfoEntries.size())
+			{
+				result = 1;
+				unsigned long channelLength = getChannelLengthInBytes();
+				unsigned long channelDataOffset = (channelIndex == 0) ? 0x00 : channelInfoEntries[channelIndex].channelDataOffset;
+				dataOut.resize(channelLength, 0x00);
+
+				// The packet's body and padding are contiguous in the file, so a channel may run over into the padding.
+				const std::vector<unsigned char>* body = &packetContents.body;
+				const std::vector<unsigned char>* padding = &packetContents.padding;
+				for (unsigned long i = 0; i < channelLength; i++)
+				{
+					std::size_t sourceIndex = std::size_t(channelDataOffset) + i;
+					if (sourceIndex < body->size())
+					{
+						dataOut[i] = (*body)[sourceIndex];
+					}
+					else if ((sourceIndex - body->size()) < padding->size())
+					{
+						dataOut[i] = (*padding)[sourceIndex - body->size()];
+					}
+					else
+					{
+						break;
+					}
+				}
+			}
+
+			return result;
+		}
+		gcADPCMStreamDecoder waveInfo::getChannelDecoder(unsigned long channelIndex, unsigned long checkpointIntervalIn) const
+		{
+			gcADPCMStreamDecoder result;
+
+			if (channelIndex < channelInfoEntries.size() && channelIndex < adpcmInfoEntries.size())
+			{
+				unsigned long channelDataOffset = (channelIndex == 0) ? 0x00 : channelInfoEntries[channelIndex].channelDataOffset;
+				const std::vector<unsigned char>* body = &packetContents.body;
+				std::size_t spanLength = 0x00;
+				if (channelDataOffset < body->size())
+				{
+					spanLength = std::min<std::size_t>(getChannelLengthInBytes(), body->size() - channelDataOffset);
+				}
+				const adpcmInfo* channelADPCMInfo = &adpcmInfoEntries[channelIndex];
+				result = gcADPCMStreamDecoder((spanLength > 0) ? body->data() + channelDataOffset : nullptr, spanLength, channelADPCMInfo->coefficients,
+					nibblesToSamples(nibbles), signed short(channelADPCMInfo->yn1), signed short(channelADPCMInfo->yn2), checkpointIntervalIn);
 			}
 
 			return result;
 		}
+		void waveInfo::setChannelLayout(unsigned char channelCountIn, unsigned long channelDataStrideIn)
+		{
+			channels = channelCountIn;
+			channelInfoTableOffset = 0x1C;
+
+			channelInfo channelTemplate{};
+			channelTemplate.volFrontLeft = 0x00;
+			channelTemplate.volFrontRight = 0x00;
+			channelTemplate.volBackLeft = 0x00;
+			channelTemplate.volBackRight = 0x00;
+			channelTemplate.reserved = 0x00;
+			if (!channelInfoEntries.empty())
+			{
+				channelTemplate = channelInfoEntries.back();
+			}
+			channelInfoEntries.resize(channelCountIn, channelTemplate);
+			channelInfoTable.resize(channelCountIn);
+			if (encoding == 2)
+			{
+				adpcmInfoEntries.resize(channelCountIn);
+			}
+
+			unsigned long channelInfoBase = channelInfoTableOffset + (channelCountIn * sizeof(unsigned long));
+			unsigned long adpcmInfoBase = channelInfoBase + (channelCountIn * channelInfo::size());
+			for (unsigned long i = 0; i < channelCountIn; i++)
+			{
+				channelInfoTable[i] = channelInfoBase + (i * channelInfo::size());
+				channelInfoEntries[i].channelDataOffset = i * channelDataStrideIn;
+				channelInfoEntries[i].adpcmInfoOffset = adpcmInfoBase + (i * adpcmInfo::size());
+			}
+		}
 		void waveInfo::copyOverWaveInfoProperties(const waveInfo& sourceInfo)
 		{
 			address = brsarAddressConsts::bac_NOT_IN_FILE;
@@ -423,7 +546,7 @@ namespace lava
 
 			return result;
 		}
-		bool dataInfo::populate(const lava::byteArray& bodyIn, std::size_t addressIn)
+		bool dataInfo::populateWSDInfo(const lava::byteArray& bodyIn, std::size_t addressIn)
 		{
 			bool result = 0;
 
@@ -447,6 +570,18 @@ namespace lava
 				wsdRandomizerTableRef = brawlReference(bodyIn.getLLong(address + 0x2C));
 				wsdPadding = bodyIn.getLong(address + 0x34);
 
+				result = 1;
+			}
+
+			return result;
+		}
+		bool dataInfo::populateTrackTable(const lava::byteArray& bodyIn, std::size_t addressIn)
+		{
+			bool result = 0;
+
+			if (bodyIn.populated())
+			{
+				address = addressIn;
 				ttReferenceList1.populate(bodyIn, address + 0x38);
 				ttIntermediateReference = brawlReference(bodyIn.getLLong(address + 0x44));
 				ttReferenceList2.populate(bodyIn, address + 0x4C);
@@ -455,6 +590,18 @@ namespace lava
 				ttNoteIndex = bodyIn.getLong(address + 0x60);
 				ttReserved = bodyIn.getLong(address + 0x64);
 
+				result = 1;
+			}
+
+			return result;
+		}
+		bool dataInfo::populateNoteTable(const lava::byteArray& bodyIn, std::size_t addressIn)
+		{
+			bool result = 0;
+
+			if (bodyIn.populated())
+			{
+				address = addressIn;
 				ntReferenceList.populate(bodyIn, address + 0x68);
 				ntWaveIndex = bodyIn.getLong(address + 0x74);
 				ntAttack = bodyIn.getChar(address + 0x78);
@@ -480,6 +627,84 @@ namespace lava
 
 			return result;
 		}
+		bool dataInfo::populate(const lava::byteArray& bodyIn, std::size_t addressIn)
+		{
+			bool result = 0;
+
+			if (bodyIn.populated())
+			{
+				result = populateWSDInfo(bodyIn, addressIn);
+				result &= populateTrackTable(bodyIn, addressIn);
+				result &= populateNoteTable(bodyIn, addressIn);
+			}
+
+			return result;
+		}
+
+		dataInfoView::dataInfoView(const std::vector<unsigned char>* sourceIn, unsigned long addressIn) : source(sourceIn), address(addressIn) {}
+		bool dataInfoView::valid() const
+		{
+			return source != nullptr && address != ULONG_MAX && (address + dataInfo::recordLength) <= source->size();
+		}
+		unsigned long dataInfoView::getWaveIndex() const
+		{
+			unsigned long result = ULONG_MAX;
+
+			if (valid())
+			{
+				result = getFundamentalFromVec<unsigned long>(*source, address + 0x74);
+			}
+
+			return result;
+		}
+		const dataInfo& dataInfoView::decodePart(unsigned char partIn) const
+		{
+			if (decoded == nullptr)
+			{
+				decoded = std::make_shared<decodedRecord>();
+			}
+			if (!(decoded->partsMask & partIn) && valid())
+			{
+				// Only the record itself is copied out, and only the once.
+				lava::byteArray recordArr(source->data() + address, dataInfo::recordLength);
+				switch (partIn)
+				{
+					case dp_WSD_INFO: { decoded->info.populateWSDInfo(recordArr, 0x00); break; }
+					case dp_TRACK_TABLE: { decoded->info.populateTrackTable(recordArr, 0x00); break; }
+					case dp_NOTE_TABLE: { decoded->info.populateNoteTable(recordArr, 0x00); break; }
+					default: { break; }
+				}
+				decoded->info.address = address;
+				decoded->partsMask |= partIn;
+			}
+			return decoded->info;
+		}
+		const dataInfo& dataInfoView::getWSDInfo() const
+		{
+			return decodePart(dp_WSD_INFO);
+		}
+		const dataInfo& dataInfoView::getTrackTable() const
+		{
+			return decodePart(dp_TRACK_TABLE);
+		}
+		const dataInfo& dataInfoView::getNoteTable() const
+		{
+			return decodePart(dp_NOTE_TABLE);
+		}
+		bool dataInfoView::materialize(dataInfo& dataInfoOut) const
+		{
+			bool result = 0;
+
+			if (valid())
+			{
+				getWSDInfo();
+				getTrackTable();
+				dataInfoOut = getNoteTable();
+				result = 1;
+			}
+
+			return result;
+		}
 		bool dataInfo::exportContents(std::ostream& destinationStream) const
 		{
 			bool result = 0;
@@ -654,6 +879,8 @@ namespace lava
 					i++;
 				}
 
+				// If the trie is malformed, there's just no lookup table; findString() falls back to walking the source nodes.
+				buildLookupTable();
 				result = 1;
 			}
 
@@ -676,8 +903,83 @@ namespace lava
 			}
 			return result;
 		}
+		bool brsarSymbPTrie::buildLookupTable()
+		{
+			bool result = 0;
+
+			lookupNodes.clear();
+			if (rootID < entries.size())
+			{
+				result = 1;
+				lookupNodes.reserve(entries.size());
+
+				// Maps each source node to its position in the lookup table, so shared or cyclic links can't blow up the table.
+				std::vector<std::uint32_t> entryIDsToLookupIDs(entries.size(), UINT32_MAX);
+				// Queue of source node IDs, in the order their lookup nodes were emitted.
+				std::vector<unsigned long> nodeQueue{ rootID };
+				entryIDsToLookupIDs[rootID] = 0;
+				lookupNodes.push_back(brsarSymbPTrieLookupNode());
+
+				for (std::size_t queueCursor = 0; queueCursor < nodeQueue.size(); queueCursor++)
+				{
+					unsigned long currEntryID = nodeQueue[queueCursor];
+					const brsarSymbPTrieNode* currEntry = &entries[currEntryID];
+					brsarSymbPTrieLookupNode currLookupNode;
+					currLookupNode.posAndBit = currEntry->posAndBit;
+					currLookupNode.isLeaf = currEntry->isLeaf;
+					if (currEntry->isLeaf)
+					{
+						currLookupNode.links[0] = std::uint32_t(currEntryID);
+					}
+					else
+					{
+						unsigned long childEntryIDs[2] = { currEntry->leftID, currEntry->rightID };
+						for (std::size_t i = 0; i < 2; i++)
+						{
+							if (childEntryIDs[i] < entries.size())
+							{
+								if (entryIDsToLookupIDs[childEntryIDs[i]] == UINT32_MAX)
+								{
+									entryIDsToLookupIDs[childEntryIDs[i]] = std::uint32_t(lookupNodes.size());
+									nodeQueue.push_back(childEntryIDs[i]);
+									lookupNodes.push_back(brsarSymbPTrieLookupNode());
+								}
+								currLookupNode.links[i] = entryIDsToLookupIDs[childEntryIDs[i]];
+							}
+							else
+							{
+								result = 0;
+							}
+						}
+					}
+					lookupNodes[queueCursor] = currLookupNode;
+				}
+
+				if (!result)
+				{
+					// Malformed trie, fall back to walking the source nodes.
+					lookupNodes.clear();
+				}
+			}
+
+			return result || entries.empty();
+		}
 		brsarSymbPTrieNode brsarSymbPTrie::findString(std::string stringIn) const
 		{
+			if (!lookupNodes.empty())
+			{
+				const brsarSymbPTrieLookupNode* currentNode = &lookupNodes.front();
+
+				while (!currentNode->isLeaf)
+				{
+					std::size_t pos = currentNode->posAndBit >> 3;
+					std::size_t bit = currentNode->posAndBit & 0b00000111;
+					std::size_t goRight = (pos < stringIn.size()) ? ((stringIn[pos] >> (7 - bit)) & 0b1) : 0;
+					currentNode = &lookupNodes[currentNode->links[goRight]];
+				}
+
+				return entries[currentNode->links[0]];
+			}
 			if (rootID < numEntries)
 			{
 				const brsarSymbPTrieNode* currentNode = &entries[rootID];
@@ -870,6 +1172,179 @@ namespace lava
 
 			return result;
 		}
+		void brsarSymbSection::getTrieLeafStringIDs(const brsarSymbPTrie& sourceTrie, std::vector<unsigned long>& destinationVec) const
+		{
+			if (sourceTrie.rootID < sourceTrie.entries.size())
+			{
+				// Walk the trie depth-first, visiting left branches before right ones.
+				std::vector<bool> visitedNodes(sourceTrie.entries.size(), 0);
+				std::vector<unsigned long> nodeStack{ sourceTrie.rootID };
+				while (!nodeStack.empty())
+				{
+					unsigned long currNodeID = nodeStack.back();
+					nodeStack.pop_back();
+					if (currNodeID < sourceTrie.entries.size() && !visitedNodes[currNodeID])
+					{
+						visitedNodes[currNodeID] = 1;
+						const brsarSymbPTrieNode* currNode = &sourceTrie.entries[currNodeID];
+						if (currNode->isLeaf)
+						{
+							destinationVec.push_back(currNode->stringID);
+						}
+						else
+						{
+							nodeStack.push_back(currNode->rightID);
+							nodeStack.push_back(currNode->leftID);
+						}
+					}
+				}
+			}
+		}
+		bool brsarSymbSection::compactStringBlock(unsigned long* bytesSavedOut)
+		{
+			bool result = 0;
+
+			if (parent != nullptr && !stringEntryOffsets.empty())
+			{
+				result = 1;
+				unsigned long originalSize = paddedSize();
+				brsarInfoSection* infoSectionPtr = &parent->infoSection;
+
+				// Gather every String ID in use, Trie leaves first so that the new block follows traversal order.
+				std::vector<unsigned long> referencedStringIDs{};
+				getTrieLeafStringIDs(soundTrie, referencedStringIDs);
+				getTrieLeafStringIDs(playerTrie, referencedStringIDs);
+				getTrieLeafStringIDs(groupTrie, referencedStringIDs);
+				getTrieLeafStringIDs(bankTrie, referencedStringIDs);
+				for (std::size_t i = 0; i < infoSectionPtr->soundEntries.size(); i++)
+				{
+					referencedStringIDs.push_back(infoSectionPtr->soundEntries[i]->stringID);
+				}
+				for (std::size_t i = 0; i < infoSectionPtr->bankEntries.size(); i++)
+				{
+					referencedStringIDs.push_back(infoSectionPtr->bankEntries[i].stringID);
+				}
+				for (std::size_t i = 0; i < infoSectionPtr->playerEntries.size(); i++)
+				{
+					referencedStringIDs.push_back(infoSectionPtr->playerEntries[i].stringID);
+				}
+				for (std::size_t i = 0; i < infoSectionPtr->groupHeaders.size(); i++)
+				{
+					referencedStringIDs.push_back(infoSectionPtr->groupHeaders[i]->groupID);
+				}
+
+				// Assign new IDs, merging any strings with identical contents.
+				std::vector<unsigned long> oldIDsToNewIDs(stringEntryOffsets.size(), ULONG_MAX);
+				std::unordered_map<std::string, unsigned long> stringsToNewIDs{};
+				std::vector<std::string> newStrings{};
+				for (std::size_t i = 0; i < referencedStringIDs.size(); i++)
+				{
+					unsigned long oldID = referencedStringIDs[i];
+					if (oldID < oldIDsToNewIDs.size() && oldIDsToNewIDs[oldID] == ULONG_MAX)
+					{
+						std::string currString = getString(oldID);
+						auto findRes = stringsToNewIDs.find(currString);
+						if (findRes != stringsToNewIDs.end())
+						{
+							oldIDsToNewIDs[oldID] = findRes->second;
+						}
+						else
+						{
+							oldIDsToNewIDs[oldID] = newStrings.size();
+							stringsToNewIDs[currString] = newStrings.size();
+							newStrings.push_back(currString);
+						}
+					}
+				}
+
+				// Rebuild the String Block and Offset Vector.
+				unsigned long stringBlockOffset = stringListOffset + 0x04 + (newStrings.size() * sizeof(unsigned long));
+				std::vector<unsigned long> newStringEntryOffsets(newStrings.size(), ULONG_MAX);
+				std::vector<unsigned char> newStringBlock{};
+				for (std::size_t i = 0; i < newStrings.size(); i++)
+				{
+					newStringEntryOffsets[i] = stringBlockOffset + newStringBlock.size();
+					newStringBlock.insert(newStringBlock.end(), newStrings[i].begin(), newStrings[i].end());
+					newStringBlock.push_back(0x00);
+				}
+				newStringBlock.resize(padLengthTo(newStringBlock.size(), 0x04), 0x00);
+				stringEntryOffsets = newStringEntryOffsets;
+				stringBlock = newStringBlock;
+
+				// Remap every String ID reference.
+				brsarSymbPTrie* tries[4] = { &soundTrie, &playerTrie, &groupTrie, &bankTrie };
+				for (std::size_t i = 0; i < 4; i++)
+				{
+					for (std::size_t u = 0; u < tries[i]->entries.size(); u++)
+					{
+						brsarSymbPTrieNode* currNode = &tries[i]->entries[u];
+						if (currNode->isLeaf && currNode->stringID < oldIDsToNewIDs.size())
+						{
+							currNode->stringID = oldIDsToNewIDs[currNode->stringID];
+						}
+					}
+				}
+				for (std::size_t i = 0; i < infoSectionPtr->soundEntries.size(); i++)
+				{
+					brsarInfoSoundEntry* currEntry = infoSectionPtr->soundEntries[i].get();
+					if (currEntry->stringID < oldIDsToNewIDs.size())
+					{
+						currEntry->stringID = oldIDsToNewIDs[currEntry->stringID];
+					}
+				}
+				for (std::size_t i = 0; i < infoSectionPtr->bankEntries.size(); i++)
+				{
+					brsarInfoBankEntry* currEntry = &infoSectionPtr->bankEntries[i];
+					if (currEntry->stringID < oldIDsToNewIDs.size())
+					{
+						currEntry->stringID = oldIDsToNewIDs[currEntry->stringID];
+					}
+				}
+				for (std::size_t i = 0; i < infoSectionPtr->playerEntries.size(); i++)
+				{
+					brsarInfoPlayerEntry* currEntry = &infoSectionPtr->playerEntries[i];
+					if (currEntry->stringID < oldIDsToNewIDs.size())
+					{
+						currEntry->stringID = oldIDsToNewIDs[currEntry->stringID];
+					}
+				}
+				for (std::size_t i = 0; i < infoSectionPtr->groupHeaders.size(); i++)
+				{
+					brsarInfoGroupHeader* currHeader = infoSectionPtr->groupHeaders[i].get();
+					if (currHeader->groupID < oldIDsToNewIDs.size())
+					{
+						currHeader->groupID = oldIDsToNewIDs[currHeader->groupID];
+					}
+				}
+				for (auto& fileGroupList : infoSectionPtr->fileIDsToGroupInfoIndecesThatUseThem)
+				{
+					for (std::size_t i = 0; i < fileGroupList.second.size(); i++)
+					{
+						if (fileGroupList.second[i] < oldIDsToNewIDs.size())
+						{
+							fileGroupList.second[i] = oldIDsToNewIDs[fileGroupList.second[i]];
+						}
+					}
+				}
+
+				// The Tries directly follow the String Block, so their offsets move with it.
+				soundTrieOffset = stringBlockOffset + stringBlock.size();
+				playerTrieOffset = soundTrieOffset + soundTrie.size();
+				groupTrieOffset = playerTrieOffset + playerTrie.size();
+				bankTrieOffset = groupTrieOffset + groupTrie.size();
+
+				parent->signalSYMBSectionSizeChange();
+				result &= infoSectionPtr->updateGroupEntryAddressValues();
+
+				if (bytesSavedOut != nullptr)
+				{
+					unsigned long newSize = paddedSize();
+					*bytesSavedOut = (originalSize > newSize) ? originalSize - newSize : 0x00;
+				}
+			}
+
+			return result;
+		}
 
 		/* BRSAR Symb Section */
 
@@ -2630,25 +3105,214 @@ namespace lava
 
 		/* BRSAR File Section */
 
-		/* RWSD */
+		/* LABL */
 
-		void rwsdWaveSection::waveEntryPushBack(const waveInfo& sourceWave)
+		unsigned long lablEntry::size() const
 		{
-			entries.push_back(sourceWave);
-			entries.front().address = brsarAddressConsts::bac_NOT_IN_FILE;
+			unsigned long result = 0x00;
+
+			result += sizeof(dataOffset);
+			result += sizeof(unsigned long); // Size of Name Length Field
+			result += padLengthTo(name.size() + 1, 0x04); // Null-Terminated Name, padded to 4 bytes
+
+			return result;
 		}
-		void rwsdWaveSection::waveEntryPushFront(const waveInfo& sourceWave)
+
+		void lablSection::rebuildNameIndex()
 		{
-			entries.insert(entries.begin(), sourceWave);
+			nameIndex.clear();
+			nameIndex.reserve(entries.size());
+			for (std::size_t i = 0; i < entries.size(); i++)
+			{
+				nameIndex.emplace(entries[i].name, i);
+			}
+		}
+		unsigned long lablSection::findLabelIndex(const std::string& nameIn) const
+		{
+			unsigned long result = ULONG_MAX;
+
+			auto findResult = nameIndex.find(nameIn);
+			if (findResult != nameIndex.end())
+			{
+				result = findResult->second;
+			}
+
+			return result;
+		}
+		bool lablSection::addLabel(const std::string& nameIn, unsigned long dataOffsetIn)
+		{
+			bool result = 0;
+
+			if (nameIndex.emplace(nameIn, entries.size()).second)
+			{
+				entries.push_back(lablEntry());
+				entries.back().dataOffset = dataOffsetIn;
+				entries.back().name = nameIn;
+				result = 1;
+			}
+
+			return result;
+		}
+		bool lablSection::renameLabel(const std::string& oldNameIn, const std::string& newNameIn)
+		{
+			bool result = 0;
+
+			unsigned long labelIndex = findLabelIndex(oldNameIn);
+			if (labelIndex != ULONG_MAX)
+			{
+				result = oldNameIn == newNameIn;
+				if (!result && nameIndex.find(newNameIn) == nameIndex.end())
+				{
+					entries[labelIndex].name = newNameIn;
+					nameIndex.erase(oldNameIn);
+					nameIndex.emplace(newNameIn, labelIndex);
+					// A duplicate of the old name may have been shadowed by this entry.
+					for (std::size_t i = labelIndex + 1; i < entries.size(); i++)
+					{
+						if (entries[i].name == oldNameIn)
+						{
+							nameIndex.emplace(oldNameIn, i);
+							break;
+						}
+					}
+					result = 1;
+				}
+			}
+
+			return result;
+		}
+		unsigned long lablSection::size() const
+		{
+			unsigned long result = 0x00;
+
+			result += sizeof(unsigned long); // Size of LABL Tag
+			result += sizeof(unsigned long); // Size of Length Field
+			result += sizeof(unsigned long); // Size of Entry Count
+			result += sizeof(unsigned long) * entries.size(); // Length of Entry Offset List
+			for (std::size_t i = 0; i < entries.size(); i++)
+			{
+				result += entries[i].size();
+			}
+
+			return result;
+		}
+		unsigned long lablSection::paddedSize(unsigned long padTo) const
+		{
+			return padLengthTo(size(), padTo);
+		}
+		bool lablSection::populate(const lava::byteArray& bodyIn, std::size_t addressIn)
+		{
+			bool result = 0;
+
+			if (bodyIn.populated() && bodyIn.getLong(addressIn) == brsarHexTags::bht_SUBF_LABL)
+			{
+				address = addressIn;
+				originalLength = bodyIn.getLong(addressIn + 0x04);
+				unsigned long entryCount = bodyIn.getLong(addressIn + 0x08);
+
+				result = entryCount != ULONG_MAX;
+				entries.clear();
+				for (unsigned long i = 0; result && i < entryCount; i++)
+				{
+					// Offsets are relative to the start of the section's body.
+					unsigned long entryAddress = addressIn + 0x08 + bodyIn.getLong(addressIn + 0x0C + (i * 0x04));
+					unsigned long nameLength = bodyIn.getLong(entryAddress + 0x04);
+					result = (entryAddress + 0x08 + nameLength) <= bodyIn.size();
+					if (result)
+					{
+						entries.push_back(lablEntry());
+						entries.back().dataOffset = bodyIn.getLong(entryAddress);
+						entries.back().name = std::string((const char*)bodyIn.data() + entryAddress + 0x08, nameLength);
+					}
+				}
+				rebuildNameIndex();
+			}
+
+			return result;
+		}
+		bool lablSection::exportContents(std::ostream& destinationStream) const
+		{
+			bool result = 0;
+			if (destinationStream.good())
+			{
+				unsigned long initialStreamPos = destinationStream.tellp();
+				unsigned long expectedLength = paddedSize();
+
+				lava::writeRawDataToStream(destinationStream, brsarHexTags::bht_SUBF_LABL);
+				lava::writeRawDataToStream(destinationStream, expectedLength);
+				lava::writeRawDataToStream(destinationStream, unsigned long(entries.size()));
+
+				unsigned long calculatedEntryOffset = sizeof(unsigned long) + (sizeof(unsigned long) * entries.size());
+				for (std::size_t i = 0; i < entries.size(); i++)
+				{
+					lava::writeRawDataToStream(destinationStream, calculatedEntryOffset);
+					calculatedEntryOffset += entries[i].size();
+				}
+				for (std::size_t i = 0; i < entries.size(); i++)
+				{
+					const lablEntry* currEntry = &entries[i];
+					lava::writeRawDataToStream(destinationStream, currEntry->dataOffset);
+					lava::writeRawDataToStream(destinationStream, unsigned long(currEntry->name.size()));
+					destinationStream.write(currEntry->name.data(), currEntry->name.size());
+					std::vector<char> padding(padLengthTo(currEntry->name.size() + 1, 0x04) - currEntry->name.size(), 0x00);
+					destinationStream.write(padding.data(), padding.size());
+				}
+
+				unsigned long finalStreamPos = destinationStream.tellp();
+				unsigned long lengthOfExport = finalStreamPos - initialStreamPos;
+				if (lengthOfExport < expectedLength)
+				{
+					std::vector<char> padding(expectedLength - lengthOfExport, 0x00);
+					destinationStream.write(padding.data(), padding.size());
+				}
+				result = destinationStream.good();
+			}
+			return result;
+		}
+
+		/* LABL */
+
+		/* RWSD */
+
+		void rwsdWaveSection::waveEntryPushBack(const waveInfo& sourceWave)
+		{
+			entries.push_back(sourceWave);
+			entries.front().address = brsarAddressConsts::bac_NOT_IN_FILE;
+		}
+		void rwsdWaveSection::waveEntryPushFront(const waveInfo& sourceWave)
+		{
+			entries.insert(entries.begin(), sourceWave);
 			entries.front().address = brsarAddressConsts::bac_NOT_IN_FILE;
 		}
+		void rwsdWaveSection::waveEntriesPushBack(const waveInfo& sourceWave, unsigned long count)
+		{
+			if (count > 0)
+			{
+				entries.insert(entries.end(), count, sourceWave);
+				for (std::size_t i = entries.size() - count; i < entries.size(); i++)
+				{
+					entries[i].address = brsarAddressConsts::bac_NOT_IN_FILE;
+				}
+			}
+		}
+		void rwsdWaveSection::waveEntriesPushFront(const waveInfo& sourceWave, unsigned long count)
+		{
+			if (count > 0)
+			{
+				entries.insert(entries.begin(), count, sourceWave);
+				for (std::size_t i = 0; i < count; i++)
+				{
+					entries[i].address = brsarAddressConsts::bac_NOT_IN_FILE;
+				}
+			}
+		}
 		unsigned long rwsdWaveSection::size() const
 		{
 			unsigned long result = 0x00;
 			result += sizeof(unsigned long); // Size of TAG Field
 			result += sizeof(unsigned long); // Size of Length Field
 			result += sizeof(unsigned long); // Size of Entry Count
-			result += sizeof(unsigned long) * entries.size(); // Length of Entry Offset List
+			result += getEntryTableEntryLength() * entries.size(); // Length of Entry Offset List
 			for (unsigned long i = 0x0; i < entries.size(); i++)
 			{
 				result += entries[i].size();
@@ -2663,7 +3327,7 @@ namespace lava
 				sizeof(unsigned long) // Length of WAVE Tag
 				+ sizeof(unsigned long) // Length of WAVE Section length field
 				+ sizeof(unsigned long) // Length of entry count field
-				+ entries.size() * sizeof(unsigned long) // Length of entry offset vector
+				+ entries.size() * getEntryTableEntryLength() // Length of entry offset vector
 				;
 
 			for (unsigned long i = 0x0; i < entries.size(); i++)
@@ -2674,6 +3338,10 @@ namespace lava
 
 			return result;
 		}
+		unsigned long rwsdWaveSection::getEntryTableEntryLength() const
+		{
+			return (referenceTable) ? brawlReference::size() : sizeof(unsigned long);
+		}
 		unsigned long rwsdWaveSection::paddedSize(unsigned long padTo) const
 		{
 			return padLengthTo(size(), padTo);
@@ -2692,11 +3360,25 @@ namespace lava
 				std::vector<unsigned long> entryOffsets{};
 				entries.clear();
 
-				for (unsigned long cursor = 0x0; cursor < (entryCount * 4); cursor += 0x04)
+				// Plain offsets are always small, so a table starting with a reference's offset flag is a reference table.
+				referenceTable = entryCount > 0 && (bodyIn.getLong(address + 0x0C) & 0xFF000000) == 0x01000000;
+				if (referenceTable)
+				{
+					for (unsigned long cursor = 0x0; cursor < (entryCount * brawlReference::size()); cursor += brawlReference::size())
+					{
+						entryOffsets.push_back(0x08 + bodyIn.getLong(address + 0x0C + cursor + 0x04));
+						entries.push_back(waveInfo());
+						entries.back().populate(bodyIn, address + entryOffsets.back());
+					}
+				}
+				else
 				{
-					entryOffsets.push_back(bodyIn.getLong(address + 0x0C + cursor));
-					entries.push_back(waveInfo());
-					entries.back().populate(bodyIn, address + entryOffsets.back());
+					for (unsigned long cursor = 0x0; cursor < (entryCount * 4); cursor += 0x04)
+					{
+						entryOffsets.push_back(bodyIn.getLong(address + 0x0C + cursor));
+						entries.push_back(waveInfo());
+						entries.back().populate(bodyIn, address + entryOffsets.back());
+					}
 				}
 
 				result = 1;
@@ -2704,6 +3386,27 @@ namespace lava
 
 			return result;
 		}
+		unsigned long rwsdWaveSection::getEntryAddress(const std::vector<unsigned char>& bodyIn, std::size_t addressIn, unsigned long entryIndexIn)
+		{
+			unsigned long result = ULONG_MAX;
+
+			if (getFundamentalFromVec<unsigned long>(bodyIn, addressIn) == brsarHexTags::bht_SUBF_WAVE
+				&& entryIndexIn < getFundamentalFromVec<unsigned long>(bodyIn, addressIn + 0x08))
+			{
+				// Mirrors populate()'s handling of reference tables and plain offset tables.
+				unsigned long firstTableValue = getFundamentalFromVec<unsigned long>(bodyIn, addressIn + 0x0C);
+				if ((firstTableValue & 0xFF000000) == 0x01000000)
+				{
+					result = addressIn + 0x08 + getFundamentalFromVec<unsigned long>(bodyIn, addressIn + 0x0C + (entryIndexIn * brawlReference::size()) + 0x04);
+				}
+				else
+				{
+					result = addressIn + getFundamentalFromVec<unsigned long>(bodyIn, addressIn + 0x0C + (entryIndexIn * 0x04));
+				}
+			}
+
+			return result;
+		}
 		bool rwsdWaveSection::exportContents(std::ostream& destinationStream)
 		{
 			bool result = 0;
@@ -2719,7 +3422,15 @@ namespace lava
 				std::vector<unsigned long> calculatedEntryOffsetVec = calculateOffsetVector();
 				for (unsigned long i = 0x0; i < entries.size(); i++)
 				{
-					lava::writeRawDataToStream(destinationStream, calculatedEntryOffsetVec[i]);
+					if (referenceTable)
+					{
+						lava::writeRawDataToStream(destinationStream, unsigned long(0x01000000));
+						lava::writeRawDataToStream(destinationStream, calculatedEntryOffsetVec[i] - 0x08);
+					}
+					else
+					{
+						lava::writeRawDataToStream(destinationStream, calculatedEntryOffsetVec[i]);
+					}
 				}
 				for (unsigned long i = 0x0; i < entries.size(); i++)
 				{
@@ -2741,1014 +3452,5194 @@ namespace lava
 			}
 			return result;
 		}
-
-		bool rwsdDataSection::hasExclusiveWave(unsigned long dataSectionIndex)
+		bool rwsdWaveSection::populateWavePacket(const lava::byteArray& bodyIn, unsigned long waveIndex, unsigned long rawDataAddressIn, unsigned long specificDataEndAddressIn)
 		{
-			bool result = 1;
-			if (dataSectionIndex < entries.size())
-			{
-				dataInfo* dataInfoEntry = &entries[dataSectionIndex];
-				unsigned long dataWaveIndex = dataInfoEntry->ntWaveIndex;
+			bool result = 0;
 
-				std::size_t i = 0;
-				while (result && i < entries.size())
+			if (bodyIn.populated())
+			{
+				result = 1;
+				waveInfo* currWave = &entries[waveIndex];
+				unsigned long length = currWave->getAudioLengthInBytes();
+				unsigned long paddingLength = 0x00;
+				unsigned long currWaveDataEndpoint = rawDataAddressIn + currWave->dataLocation + length;
+				// If only the later channels of a multi-channel wave run past the end (eg. it's been hollowed out), just keep what's there.
+				if (currWaveDataEndpoint > specificDataEndAddressIn && length > currWave->getChannelLengthInBytes()
+					&& (rawDataAddressIn + currWave->dataLocation + currWave->getChannelLengthInBytes()) <= specificDataEndAddressIn)
+				{
+					length = specificDataEndAddressIn - (rawDataAddressIn + currWave->dataLocation);
+					currWaveDataEndpoint = specificDataEndAddressIn;
+				}
+				if (currWaveDataEndpoint <= specificDataEndAddressIn)
+				{
+					paddingLength = specificDataEndAddressIn - currWaveDataEndpoint;
+				}
+				else
 				{
-					if (i != dataSectionIndex)
+					unsigned long overflowAmount = currWaveDataEndpoint - specificDataEndAddressIn;
+					if (overflowAmount > length)
 					{
-						result = dataWaveIndex != entries[i].ntWaveIndex;
+						length = 0;
+						currWave->hollowOut();
+						std::cerr << "Invalid overflow detected in RWSD Wave Data!\n";
+					}
+					else
+					{
+						length -= overflowAmount;
+						currWave->nibbles -= overflowAmount * 2;
 					}
-					i++;
 				}
+				result &= currWave->packetContents.populate(bodyIn, rawDataAddressIn + currWave->dataLocation, length, paddingLength);
 			}
+
 			return result;
 		}
-		bool rwsdDataSection::isFirstToUseWave(unsigned long dataSectionIndex)
+		bool rwsdWaveSection::populateWavePackets(const lava::byteArray& bodyIn, unsigned long waveDataAddressIn, unsigned long waveDataLengthIn)
 		{
-			bool result = 1;
-			if (dataSectionIndex < entries.size())
-			{
-				dataInfo* dataInfoEntry = &entries[dataSectionIndex];
-				unsigned long dataWaveIndex = dataInfoEntry->ntWaveIndex;
+			bool result = 0;
 
-				std::size_t i = 0;
-				while (result && i < dataSectionIndex)
+			if (bodyIn.populated())
+			{
+				result = 1;
+				for (std::size_t i = 0; i < (entries.size() - 1); i++)
 				{
-					result = dataWaveIndex != entries[i].ntWaveIndex;
-					i++;
+					waveInfo* currWave = &entries[i];
+					waveInfo* nextWave = &entries[i + 1];
+					result &= populateWavePacket(bodyIn, i, waveDataAddressIn, waveDataAddressIn + nextWave->dataLocation);
 				}
+				waveInfo* finalWave = &entries.back();
+				result &= populateWavePacket(bodyIn, entries.size() - 1, waveDataAddressIn, waveDataAddressIn + waveDataLengthIn);
 			}
+
 			return result;
 		}
-		unsigned long rwsdDataSection::size() const
+		bool rwsdWaveSection::exportRawDataSection(std::ostream& destinationStream) const
 		{
-			unsigned long result = 0x00;
+			bool result = 0;
 
-			result += sizeof(unsigned long); // Size of DATA Tag
-			result += sizeof(unsigned long); // Size of Length Field
-			result += calcRefVecSize(entries.size()); // Length of the Entries Ref Vec
-			for (int i = 0; i < entries.size(); i++) 
+			if (destinationStream.good())
 			{
-				result += entries[i].size(); // Size of Each Entry
+				for (unsigned long i = 0; i < entries.size(); i++)
+				{
+					const waveInfo* currWave = &entries[i];
+					destinationStream.write((const char*)currWave->packetContents.body.data(), currWave->packetContents.body.size());
+					destinationStream.write((const char*)currWave->packetContents.padding.data(), currWave->packetContents.padding.size());
+				}
+				result = destinationStream.good();
 			}
 
 			return result;
 		}
-		unsigned long rwsdDataSection::paddedSize(unsigned long padTo) const
-		{
-			return padLengthTo(size(), padTo);
-		}
-		bool rwsdDataSection::populate(const lava::byteArray& bodyIn, std::size_t addressIn)
+		dsp rwsdWaveSection::exportWaveRawDataToDSP(unsigned long waveSectionIndex, unsigned long channelIndex) const
 		{
-			bool result = 0;
+			dsp result;
 
-			if (bodyIn.populated() && bodyIn.getLong(addressIn) == brsarHexTags::bht_SUBF_DATA)
+			if (waveSectionIndex < entries.size())
 			{
-				address = addressIn;
-				originalLength = bodyIn.getLong(addressIn + 0x04); // We no longer need this either, this will be calculated as needed
-				entryReferences.populate(bodyIn, addressIn + 0x08);
-				std::vector<brawlReference>* refVecPtr = &entryReferences.refs;
-				std::size_t entryCount = refVecPtr->size();
-				unsigned long entryTargetAddress = ULONG_MAX;
-				entries.resize(entryCount);
-				for (std::size_t i = 0; i < entryCount; i++)
+				const waveInfo* targetWaveInfo = &entries[waveSectionIndex];
+				if (channelIndex < targetWaveInfo->adpcmInfoEntries.size())
 				{
-					entryTargetAddress = address + 0x08 + refVecPtr->at(i).getAddress();
-					if (bodyIn.getLong(entryTargetAddress) == 0x01000000)
+					result.nibbleCount = targetWaveInfo->nibbles;
+					result.sampleCount = nibblesToSamples(result.nibbleCount);
+					result.nibbleCount = samplesToNibbles(result.sampleCount);
+					result.sampleRate = targetWaveInfo->getSampleRate();
+					result.loops = targetWaveInfo->looped;
+					result.loopStart = targetWaveInfo->loopStartSample;
+					if (result.loops)
 					{
-						entries[i].populate(bodyIn, entryTargetAddress);
+						result.loopEnd = result.sampleCount - 1;
 					}
 					else
 					{
-						std::cerr << "Skipping Data Entry @ " << entryTargetAddress << "\n";
+						result.loopEnd = 0x00;
+					}
+					result.soundInfo = targetWaveInfo->adpcmInfoEntries[channelIndex];
+					targetWaveInfo->getChannelData(channelIndex, result.body);
+					unsigned long desiredLength = nibblesToBytes(result.nibbleCount);
+					if (result.body.size() < desiredLength)
+					{
+						result.body.resize(desiredLength);
 					}
 				}
-
-				result = 1;
 			}
 
 			return result;
 		}
-		bool rwsdDataSection::exportContents(std::ostream& destinationStream)
+		bool rwsdWaveSection::exportWaveRawDataToDSPs(unsigned long waveSectionIndex, std::vector<dsp>& dspsOut, unsigned long threadCount) const
 		{
 			bool result = 0;
-			if (destinationStream.good())
-			{
-				unsigned long initialStreamPos = destinationStream.tellp();
-				unsigned long expectedLength = paddedSize();
 
-				lava::writeRawDataToStream(destinationStream, brsarHexTags::bht_SUBF_DATA);
-				lava::writeRawDataToStream(destinationStream, expectedLength);
-				entryReferences.exportContents(destinationStream);
-				for (std::size_t i = 0; i < entries.size(); i++)
+			dspsOut.clear();
+			if (waveSectionIndex < entries.size())
+			{
+				const waveInfo* targetWaveInfo = &entries[waveSectionIndex];
+				dspsOut.resize(targetWaveInfo->adpcmInfoEntries.size());
+				lava::parallelFor(dspsOut.size(), [&](std::size_t i)
 				{
-					entries[i].exportContents(destinationStream);
-				}
-				unsigned long finalStreamPos = destinationStream.tellp();
-				unsigned long lengthOfExport = finalStreamPos - initialStreamPos;
-				if (lengthOfExport != expectedLength)
+					dspsOut[i] = exportWaveRawDataToDSP(waveSectionIndex, i);
+				}, threadCount);
+
+				result = !dspsOut.empty();
+				for (std::size_t i = 0; result && i < dspsOut.size(); i++)
 				{
-					if (lengthOfExport < expectedLength)
-					{
-						std::vector<char> padding(expectedLength - lengthOfExport, 0x00);
-						destinationStream.write(padding.data(), padding.size());
-					}
+					result = !dspsOut[i].body.empty();
 				}
-				result = destinationStream.good();
 			}
+
 			return result;
 		}
-
-		/*bool rwsdHeader::populate(const lava::byteArray& bodyIn, std::size_t addressIn)
+		bool rwsdWaveSection::exportWaveRawDataToDSPFiles(unsigned long waveSectionIndex, std::string outputPathBase, unsigned long threadCount) const
+		{
+			bool result = 0;
+
+			std::vector<dsp> channelDSPs{};
+			if (exportWaveRawDataToDSPs(waveSectionIndex, channelDSPs, threadCount))
+			{
+				std::vector<char> channelWritten(channelDSPs.size(), 0);
+				lava::parallelFor(channelDSPs.size(), [&](std::size_t i)
+				{
+					std::string outputPath = outputPathBase;
+					if (channelDSPs.size() > 1)
+					{
+						outputPath += "_ch" + std::to_string(i);
+					}
+					outputPath += ".dsp";
+					std::ofstream dspOutput(outputPath, std::ios_base::out | std::ios_base::binary);
+					if (dspOutput.is_open())
+					{
+						channelWritten[i] = channelDSPs[i].exportContents(dspOutput);
+					}
+				}, threadCount);
+				result = std::find(channelWritten.begin(), channelWritten.end(), 0) == channelWritten.end();
+			}
+
+			return result;
+		}
+		bool rwsdWaveSection::exportWaveRawDataToWAV(unsigned long waveSectionIndex, wav& wavOut, unsigned long threadCount) const
+		{
+			bool result = 0;
+
+			std::vector<dsp> channelDSPs{};
+			if (exportWaveRawDataToDSPs(waveSectionIndex, channelDSPs, threadCount))
+			{
+				std::vector<std::vector<signed short>> channelSamples(channelDSPs.size());
+				std::vector<char> channelDecoded(channelDSPs.size(), 0);
+				lava::parallelFor(channelDSPs.size(), [&](std::size_t i)
+				{
+					channelDecoded[i] = channelDSPs[i].decodeToPCM(channelSamples[i]);
+				}, threadCount);
+				if (std::find(channelDecoded.begin(), channelDecoded.end(), 0) == channelDecoded.end())
+				{
+					const dsp* firstDSP = &channelDSPs.front();
+					wavOut.sampleRate = firstDSP->sampleRate;
+					wavOut.channels = std::move(channelSamples);
+					// Waves always loop through to their last sample.
+					wavOut.looped = firstDSP->loops && firstDSP->sampleCount > 0 && nibblesToSamples(firstDSP->loopStart) < firstDSP->sampleCount;
+					wavOut.loopStartSample = (wavOut.looped) ? nibblesToSamples(firstDSP->loopStart) : 0x00;
+					wavOut.loopEndSample = (wavOut.looped) ? firstDSP->sampleCount - 1 : 0x00;
+					result = 1;
+				}
+			}
+
+			return result;
+		}
+		bool rwsdWaveSection::exportWaveRawDataToWAV(unsigned long waveSectionIndex, std::string wavOutputPath, unsigned long threadCount) const
+		{
+			bool result = 0;
+
+			wav wavOut;
+			if (exportWaveRawDataToWAV(waveSectionIndex, wavOut, threadCount))
+			{
+				result = wavOut.exportContents(wavOutputPath);
+			}
+
+			return result;
+		}
+		bool rwsdWaveSection::updateWaveEntryDataLocations()
+		{
+			bool result = 1;
+
+			unsigned long positionAccumulator = 0x00;
+			for (unsigned long i = 0; i < entries.size(); i++)
+			{
+				waveInfo* currEntry = &entries[i];
+				currEntry->dataLocation = positionAccumulator;
+				positionAccumulator += currEntry->packetContents.body.size() + currEntry->packetContents.padding.size();
+			}
+
+			return result;
+		}
+		bool rwsdWaveSection::overwriteWaveRawData(unsigned long waveSectionIndex, const std::vector<unsigned char>& rawDataIn)
+		{
+			bool result = 0;
+
+			if (waveSectionIndex < entries.size())
+			{
+				waveInfo* targetWaveInfo = &entries[waveSectionIndex];
+				targetWaveInfo->packetContents.body = rawDataIn;
+				targetWaveInfo->packetContents.padding = std::vector<unsigned char> (0x10 - (targetWaveInfo->packetContents.body.size() % 0x10), 0x00);
+				targetWaveInfo->nibbles = targetWaveInfo->packetContents.body.size() * 2;
+				result = updateWaveEntryDataLocations();
+			}
+
+			return result;
+		}
+		bool rwsdWaveSection::overwriteWaveRawDataWithDSP(unsigned long waveSectionIndex, const dsp& dspIn)
+		{
+			bool result = 0;
+
+			if (waveSectionIndex < entries.size())
+			{
+				waveInfo* targetWaveInfo = &entries[waveSectionIndex];
+				targetWaveInfo->encoding = 2;
+				targetWaveInfo->channels = 1;
+				targetWaveInfo->looped = dspIn.loops;
+				targetWaveInfo->loopStartSample = dspIn.loopStart;
+				targetWaveInfo->nibbles = dspIn.nibbleCount;
+				targetWaveInfo->sampleRate24 = dspIn.sampleRate >> 16;
+				targetWaveInfo->sampleRate = 0x0000FFFF & dspIn.sampleRate;
+				targetWaveInfo->channelInfoTable.resize(1);
+				targetWaveInfo->channelInfoEntries.resize(1);
+				targetWaveInfo->adpcmInfoEntries.resize(1);
+				targetWaveInfo->adpcmInfoEntries.back() = dspIn.soundInfo;
+				// The source's loop context can't be trusted to match its audio, so work it out from the audio itself.
+				if (dspIn.loops)
+				{
+					adpcmInfo* targetADPCMInfo = &targetWaveInfo->adpcmInfoEntries.back();
+					dspIn.getLoopContext(targetADPCMInfo->lps, targetADPCMInfo->lyn1, targetADPCMInfo->lyn2);
+				}
+				result = overwriteWaveRawData(waveSectionIndex, dspIn.body);
+			}
+
+			return result;
+		}
+		bool rwsdWaveSection::overwriteWaveRawDataWithDSP(unsigned long waveSectionIndex, std::string dspPathIn)
+		{
+			bool result = 0;
+
+			if (std::filesystem::is_regular_file(dspPathIn))
+			{
+				dsp tempDSP;
+				if (tempDSP.populate(dspPathIn, 0x00))
+				{
+					result = overwriteWaveRawDataWithDSP(waveSectionIndex, tempDSP);
+				}
+			}
+
+			return result;
+		}
+		bool rwsdWaveSection::overwriteWaveRawDataWithDSPs(unsigned long waveSectionIndex, const std::vector<dsp>& dspsIn)
+		{
+			bool result = 0;
+
+			if (dspsIn.size() == 1)
+			{
+				result = overwriteWaveRawDataWithDSP(waveSectionIndex, dspsIn.front());
+			}
+			else if (waveSectionIndex < entries.size() && !dspsIn.empty() && dspsIn.size() <= UCHAR_MAX)
+			{
+				const dsp* firstDSP = &dspsIn.front();
+				unsigned long channelLength = firstDSP->body.size();
+				bool channelsMatch = 1;
+				for (std::size_t i = 1; channelsMatch && i < dspsIn.size(); i++)
+				{
+					channelsMatch &= dspsIn[i].sampleRate == firstDSP->sampleRate;
+					channelsMatch &= dspsIn[i].nibbleCount == firstDSP->nibbleCount;
+					channelsMatch &= dspsIn[i].loops == firstDSP->loops;
+					channelsMatch &= dspsIn[i].loopStart == firstDSP->loopStart;
+					channelLength = std::max<unsigned long>(channelLength, dspsIn[i].body.size());
+				}
+				if (channelsMatch)
+				{
+					waveInfo* targetWaveInfo = &entries[waveSectionIndex];
+					unsigned long channelStride = padLengthTo(channelLength, _WAVE_CHANNEL_DATA_ALIGNMENT);
+					targetWaveInfo->encoding = 2;
+					targetWaveInfo->looped = firstDSP->loops;
+					targetWaveInfo->loopStartSample = firstDSP->loopStart;
+					targetWaveInfo->sampleRate24 = firstDSP->sampleRate >> 16;
+					targetWaveInfo->sampleRate = 0x0000FFFF & firstDSP->sampleRate;
+					targetWaveInfo->setChannelLayout(unsigned char(dspsIn.size()), channelStride);
+
+					// Every channel but the last is padded out to the stride; the packet's own padding follows the last.
+					std::vector<unsigned char> combinedBody((channelStride * (dspsIn.size() - 1)) + dspsIn.back().body.size(), 0x00);
+					for (std::size_t i = 0; i < dspsIn.size(); i++)
+					{
+						targetWaveInfo->adpcmInfoEntries[i] = dspsIn[i].soundInfo;
+						if (dspsIn[i].loops)
+						{
+							adpcmInfo* targetADPCMInfo = &targetWaveInfo->adpcmInfoEntries[i];
+							dspsIn[i].getLoopContext(targetADPCMInfo->lps, targetADPCMInfo->lyn1, targetADPCMInfo->lyn2);
+						}
+						std::copy(dspsIn[i].body.begin(), dspsIn[i].body.end(), combinedBody.begin() + (i * channelStride));
+					}
+					result = overwriteWaveRawData(waveSectionIndex, combinedBody);
+					// overwriteWaveRawData derives the nibble count from the whole body, but it's meant to describe one channel.
+					targetWaveInfo->nibbles = firstDSP->body.size() * 2;
+				}
+				else
+				{
+					std::cerr << "Unable to import multi-channel audio: channel DSPs must share sample rate, length, and loop points!\n";
+				}
+			}
+
+			return result;
+		}
+		bool rwsdWaveSection::overwriteWaveRawDataWithDSPs(unsigned long waveSectionIndex, const std::vector<std::string>& dspPathsIn)
+		{
+			bool result = 0;
+
+			std::vector<dsp> channelDSPs(dspPathsIn.size());
+			bool allPopulated = !dspPathsIn.empty();
+			for (std::size_t i = 0; allPopulated && i < dspPathsIn.size(); i++)
+			{
+				allPopulated = std::filesystem::is_regular_file(dspPathsIn[i]) && channelDSPs[i].populate(dspPathsIn[i], 0x00);
+			}
+			if (allPopulated)
+			{
+				result = overwriteWaveRawDataWithDSPs(waveSectionIndex, channelDSPs);
+			}
+
+			return result;
+		}
+		bool rwsdWaveSection::overwriteWaveRawDataWithWAV(unsigned long waveSectionIndex, const wav& wavIn, unsigned long threadCount, unsigned char encodeModeIn,
+			unsigned long targetSampleRateIn, std::vector<gcADPCMEncodeReport>* reportsOut)
+		{
+			bool result = 0;
+
+			std::vector<dsp> channelDSPs{};
+			if (wavIn.channels.size() <= UCHAR_MAX && wavIn.encodeToDSPs(channelDSPs, encodeModeIn, targetSampleRateIn, threadCount, reportsOut))
+			{
+				result = overwriteWaveRawDataWithDSPs(waveSectionIndex, channelDSPs);
+			}
+			else
+			{
+				std::cerr << "[ERROR] Unable to encode WAV to GC-ADPCM!\n";
+			}
+
+			return result;
+		}
+		bool rwsdWaveSection::overwriteWaveRawDataWithWAV(unsigned long waveSectionIndex, std::string wavPathIn, unsigned long threadCount, unsigned char encodeModeIn,
+			unsigned long targetSampleRateIn, std::vector<gcADPCMEncodeReport>* reportsOut)
+		{
+			bool result = 0;
+
+			wav wavIn;
+			if (wavIn.populate(wavPathIn))
+			{
+				result = overwriteWaveRawDataWithWAV(waveSectionIndex, wavIn, threadCount, encodeModeIn, targetSampleRateIn, reportsOut);
+			}
+
+			return result;
+		}
+		bool rwsdWaveSection::overwriteWaveRawDataWithWAVs(const std::vector<std::pair<unsigned long, std::string>>& waveIndicesToWAVPathsIn, unsigned long threadCount,
+			unsigned char encodeModeIn, unsigned long targetSampleRateIn, std::vector<char>* succeededOut, std::vector<std::vector<gcADPCMEncodeReport>>* reportsOut)
+		{
+			bool result = 1;
+
+			// Reading, resampling, and encoding each WAV is independent of the others, so that all happens in parallel, one WAV per thread.
+			// Only splicing the results into the wave section has to happen in order.
+			std::vector<std::vector<dsp>> encodedWAVs(waveIndicesToWAVPathsIn.size());
+			std::vector<char> succeeded(waveIndicesToWAVPathsIn.size(), 0);
+			std::vector<std::vector<gcADPCMEncodeReport>> encodeReports((reportsOut != nullptr) ? waveIndicesToWAVPathsIn.size() : 0);
+			lava::parallelFor(waveIndicesToWAVPathsIn.size(), [&](std::size_t i)
+			{
+				wav wavIn;
+				if (wavIn.populate(waveIndicesToWAVPathsIn[i].second) && wavIn.channels.size() <= UCHAR_MAX)
+				{
+					succeeded[i] = wavIn.encodeToDSPs(encodedWAVs[i], encodeModeIn, targetSampleRateIn, 1, (reportsOut != nullptr) ? &encodeReports[i] : nullptr);
+				}
+			}, threadCount);
+
+			for (std::size_t i = 0; i < waveIndicesToWAVPathsIn.size(); i++)
+			{
+				if (succeeded[i])
+				{
+					succeeded[i] = overwriteWaveRawDataWithDSPs(waveIndicesToWAVPathsIn[i].first, encodedWAVs[i]);
+				}
+				if (!succeeded[i])
+				{
+					std::cerr << "[ERROR] Unable to import \"" << waveIndicesToWAVPathsIn[i].second << "\" over wave " << waveIndicesToWAVPathsIn[i].first << "!\n";
+					if (reportsOut != nullptr)
+					{
+						encodeReports[i].clear();
+					}
+				}
+				// Free each WAV's DSPs as soon as they've been spliced in.
+				std::vector<dsp>().swap(encodedWAVs[i]);
+				result &= succeeded[i] != 0;
+			}
+			if (succeededOut != nullptr)
+			{
+				*succeededOut = succeeded;
+			}
+			if (reportsOut != nullptr)
+			{
+				*reportsOut = std::move(encodeReports);
+			}
+
+			return result;
+		}
+
+		void rwsdDataSection::rebuildWaveReferrerIndex()
+		{
+			waveIndecesToReferrerDataIndeces.clear();
+			for (unsigned long i = 0; i < entries.size(); i++)
+			{
+				waveIndecesToReferrerDataIndeces[entries[i].ntWaveIndex].push_back(i);
+			}
+		}
+		bool rwsdDataSection::setEntryWaveIndex(unsigned long dataSectionIndex, unsigned long waveIndexIn)
+		{
+			bool result = 0;
+
+			if (dataSectionIndex < entries.size())
+			{
+				result = 1;
+				unsigned long oldWaveIndex = entries[dataSectionIndex].ntWaveIndex;
+				if (oldWaveIndex != waveIndexIn)
+				{
+					auto oldReferrersItr = waveIndecesToReferrerDataIndeces.find(oldWaveIndex);
+					if (oldReferrersItr != waveIndecesToReferrerDataIndeces.end())
+					{
+						std::vector<unsigned long>* oldReferrers = &oldReferrersItr->second;
+						auto entryItr = std::lower_bound(oldReferrers->begin(), oldReferrers->end(), dataSectionIndex);
+						if (entryItr != oldReferrers->end() && *entryItr == dataSectionIndex)
+						{
+							oldReferrers->erase(entryItr);
+						}
+						if (oldReferrers->empty())
+						{
+							waveIndecesToReferrerDataIndeces.erase(oldReferrersItr);
+						}
+					}
+					std::vector<unsigned long>* newReferrers = &waveIndecesToReferrerDataIndeces[waveIndexIn];
+					newReferrers->insert(std::lower_bound(newReferrers->begin(), newReferrers->end(), dataSectionIndex), dataSectionIndex);
+					entries[dataSectionIndex].ntWaveIndex = waveIndexIn;
+				}
+			}
+
+			return result;
+		}
+		unsigned long rwsdDataSection::getWaveReferenceCount(unsigned long waveIndexIn) const
+		{
+			unsigned long result = 0;
+
+			const std::vector<unsigned long>* referrers = getWaveReferrers(waveIndexIn);
+			if (referrers != nullptr)
+			{
+				result = referrers->size();
+			}
+
+			return result;
+		}
+		const std::vector<unsigned long>* rwsdDataSection::getWaveReferrers(unsigned long waveIndexIn) const
+		{
+			const std::vector<unsigned long>* result = nullptr;
+
+			auto findResult = waveIndecesToReferrerDataIndeces.find(waveIndexIn);
+			if (findResult != waveIndecesToReferrerDataIndeces.end())
+			{
+				result = &findResult->second;
+			}
+
+			return result;
+		}
+		bool rwsdDataSection::hasExclusiveWave(unsigned long dataSectionIndex)
+		{
+			bool result = 1;
+			if (dataSectionIndex < entries.size())
+			{
+				result = getWaveReferenceCount(entries[dataSectionIndex].ntWaveIndex) <= 1;
+			}
+			return result;
+		}
+		bool rwsdDataSection::isFirstToUseWave(unsigned long dataSectionIndex)
+		{
+			bool result = 1;
+			if (dataSectionIndex < entries.size())
+			{
+				const std::vector<unsigned long>* referrers = getWaveReferrers(entries[dataSectionIndex].ntWaveIndex);
+				if (referrers != nullptr && !referrers->empty())
+				{
+					result = referrers->front() >= dataSectionIndex;
+				}
+			}
+			return result;
+		}
+		unsigned long rwsdDataSection::size() const
+		{
+			unsigned long result = 0x00;
+
+			result += sizeof(unsigned long); // Size of DATA Tag
+			result += sizeof(unsigned long); // Size of Length Field
+			result += calcRefVecSize(entries.size()); // Length of the Entries Ref Vec
+			for (int i = 0; i < entries.size(); i++) 
+			{
+				result += entries[i].size(); // Size of Each Entry
+			}
+
+			return result;
+		}
+		unsigned long rwsdDataSection::paddedSize(unsigned long padTo) const
+		{
+			return padLengthTo(size(), padTo);
+		}
+		bool rwsdDataSection::populate(const lava::byteArray& bodyIn, std::size_t addressIn)
+		{
+			bool result = 0;
+
+			if (bodyIn.populated() && bodyIn.getLong(addressIn) == brsarHexTags::bht_SUBF_DATA)
+			{
+				address = addressIn;
+				originalLength = bodyIn.getLong(addressIn + 0x04); // We no longer need this either, this will be calculated as needed
+				entryReferences.populate(bodyIn, addressIn + 0x08);
+				std::vector<brawlReference>* refVecPtr = &entryReferences.refs;
+				std::size_t entryCount = refVecPtr->size();
+				unsigned long entryTargetAddress = ULONG_MAX;
+				entries.resize(entryCount);
+				for (std::size_t i = 0; i < entryCount; i++)
+				{
+					entryTargetAddress = address + 0x08 + refVecPtr->at(i).getAddress();
+					if (bodyIn.getLong(entryTargetAddress) == 0x01000000)
+					{
+						entries[i].populate(bodyIn, entryTargetAddress);
+					}
+					else
+					{
+						std::cerr << "Skipping Data Entry @ " << entryTargetAddress << "\n";
+					}
+				}
+				rebuildWaveReferrerIndex();
+
+				result = 1;
+			}
+
+			return result;
+		}
+		bool rwsdDataSection::populateEntryViews(const std::vector<unsigned char>& bodyIn, std::size_t addressIn, std::vector<dataInfoView>& viewsOut)
+		{
+			bool result = 0;
+
+			viewsOut.clear();
+			if (getFundamentalFromVec<unsigned long>(bodyIn, addressIn) == brsarHexTags::bht_SUBF_DATA)
+			{
+				result = 1;
+				// Mirrors populate(), just without decoding anything past the reference table.
+				unsigned long entryCount = getFundamentalFromVec<unsigned long>(bodyIn, addressIn + 0x08);
+				// Each reference takes 8 bytes, so a count too large for the section to hold is corrupt; don't reserve for it.
+				viewsOut.reserve(std::min<std::size_t>(entryCount, bodyIn.size() / 0x08));
+				for (unsigned long i = 0; i < entryCount; i++)
+				{
+					unsigned long entryTargetAddress = addressIn + 0x08 + getFundamentalFromVec<unsigned long>(bodyIn, addressIn + 0x0C + (i * 0x08) + 0x04);
+					if (getFundamentalFromVec<unsigned long>(bodyIn, entryTargetAddress) == 0x01000000)
+					{
+						viewsOut.push_back(dataInfoView(&bodyIn, entryTargetAddress));
+					}
+					else
+					{
+						viewsOut.push_back(dataInfoView());
+					}
+				}
+			}
+
+			return result;
+		}
+		bool rwsdDataSection::exportContents(std::ostream& destinationStream)
+		{
+			bool result = 0;
+			if (destinationStream.good())
+			{
+				unsigned long initialStreamPos = destinationStream.tellp();
+				unsigned long expectedLength = paddedSize();
+
+				lava::writeRawDataToStream(destinationStream, brsarHexTags::bht_SUBF_DATA);
+				lava::writeRawDataToStream(destinationStream, expectedLength);
+				entryReferences.exportContents(destinationStream);
+				for (std::size_t i = 0; i < entries.size(); i++)
+				{
+					entries[i].exportContents(destinationStream);
+				}
+				unsigned long finalStreamPos = destinationStream.tellp();
+				unsigned long lengthOfExport = finalStreamPos - initialStreamPos;
+				if (lengthOfExport != expectedLength)
+				{
+					if (lengthOfExport < expectedLength)
+					{
+						std::vector<char> padding(expectedLength - lengthOfExport, 0x00);
+						destinationStream.write(padding.data(), padding.size());
+					}
+				}
+				result = destinationStream.good();
+			}
+			return result;
+		}
+
+		/*bool rwsdHeader::populate(const lava::byteArray& bodyIn, std::size_t addressIn)
 		{
 			bool result = 0;
 
 			if (bodyIn.populated())
 			{
-				address = addressIn;
-				endianType = bodyIn.getShort(addressIn + 0x04);
-				version = bodyIn.getShort(addressIn + 0x06);
-				headerLength = bodyIn.getLong(addressIn + 0x08);
-				entriesOffset = bodyIn.getShort(addressIn + 0x0C);
-				entriesCount = bodyIn.getShort(addressIn + 0x0E);
+				address = addressIn;
+				endianType = bodyIn.getShort(addressIn + 0x04);
+				version = bodyIn.getShort(addressIn + 0x06);
+				headerLength = bodyIn.getLong(addressIn + 0x08);
+				entriesOffset = bodyIn.getShort(addressIn + 0x0C);
+				entriesCount = bodyIn.getShort(addressIn + 0x0E);
+
+				dataOffset = bodyIn.getLong(addressIn + 0x10);
+				dataLength = bodyIn.getLong(addressIn + 0x14);
+				waveOffset = bodyIn.getLong(addressIn + 0x18);
+				waveLength = bodyIn.getLong(addressIn + 0x1C);
+				result = 1;
+			}
+
+			return result;
+		}
+		bool rwsdHeader::exportContents(std::ostream& destinationStream)
+		{
+			bool result = 0;
+			if (destinationStream.good())
+			{
+				destinationStream << "RWSD";
+				lava::writeRawDataToStream(destinationStream, endianType);
+				lava::writeRawDataToStream(destinationStream, version);
+				lava::writeRawDataToStream(destinationStream, headerLength);
+				lava::writeRawDataToStream(destinationStream, entriesOffset);
+				lava::writeRawDataToStream(destinationStream, entriesCount);
+				lava::writeRawDataToStream(destinationStream, dataOffset);
+				lava::writeRawDataToStream(destinationStream, dataLength);
+				lava::writeRawDataToStream(destinationStream, waveOffset);
+				lava::writeRawDataToStream(destinationStream, waveLength);
+
+				result = destinationStream.good();
+			}
+			return result;
+		}
+		constexpr unsigned long rwsdHeader::size()
+		{
+			unsigned long result = 0x0;
+
+			result += sizeof(unsigned long); // Length of RWSD Tag
+			result += sizeof(endianType);
+			result += sizeof(version);
+			result += sizeof(headerLength);
+			result += sizeof(entriesOffset);
+			result += sizeof(entriesCount);
+			result += sizeof(dataOffset);
+			result += sizeof(dataLength);
+			result += sizeof(waveOffset);
+			result += sizeof(waveLength);
+
+			return result;
+		}*/
+
+		unsigned long rwsd::size()
+		{
+			unsigned long result = 0x00;
+
+			result =
+				0x20 // Header Length
+				+ getDATASectionSize() // DATA Section Size
+				+ getWAVESectionSize(); // WAVE Section Size
+
+			return result;
+		}
+		void rwsd::signalDATASectionSizeChange()
+		{
+			dataSectionCachedSize = ULONG_MAX;
+		}
+		void rwsd::signalWAVESectionSizeChange()
+		{
+			waveSectionCachedSize = ULONG_MAX;
+		}
+		unsigned long rwsd::getDATASectionSize()
+		{
+			if (dataSectionCachedSize == ULONG_MAX)
+			{
+				dataSectionCachedSize = dataSection.paddedSize();
+			}
+			return dataSectionCachedSize;
+		}
+		unsigned long rwsd::getWAVESectionSize()
+		{
+			if (waveSectionCachedSize == ULONG_MAX)
+			{
+				waveSectionCachedSize = waveSection.paddedSize();
+			}
+			return waveSectionCachedSize;
+		}
+		unsigned long rwsd::getDATASectionOffset()
+		{
+			return 0x20;
+		}
+		unsigned long rwsd::getWAVESectionOffset()
+		{
+			return getDATASectionOffset() + getDATASectionSize();
+		}
+
+		bool rwsd::populateWavePacket(const lava::byteArray& bodyIn, unsigned long waveIndex, unsigned long rawDataAddressIn, unsigned long specificDataEndAddressIn)
+		{
+			return waveSection.populateWavePacket(bodyIn, waveIndex, rawDataAddressIn, specificDataEndAddressIn);
+		}
+		bool rwsd::populateWavePackets(const lava::byteArray& bodyIn, unsigned long waveDataAddressIn, unsigned long waveDataLengthIn)
+		{
+			return waveSection.populateWavePackets(bodyIn, waveDataAddressIn, waveDataLengthIn);
+		}
+		bool rwsd::populate(const byteArray& fileBodyIn, unsigned long fileBodyAddressIn, const byteArray& rawDataIn, unsigned long rawDataAddressIn, unsigned long rawDataLengthIn)
+		{
+			bool result = 0;
+
+			if (fileBodyIn.getLong(fileBodyAddressIn) == brsarHexTags::bht_RWSD)
+			{
+				address = fileBodyAddressIn;
+
+				endianType = fileBodyIn.getShort(0x04);
+				versionNumber = fileBodyIn.getShort(0x06);
+				unsigned long dataSectionOffset = fileBodyIn.getLong(0x10);
+				unsigned long waveSectionOffset = fileBodyIn.getLong(0x18);
+
+				result = dataSection.populate(fileBodyIn, fileBodyAddressIn + dataSectionOffset);
+				result &= waveSection.populate(fileBodyIn, fileBodyAddressIn + waveSectionOffset);
+				if (result && rawDataAddressIn != ULONG_MAX && (rawDataAddressIn + rawDataLengthIn) <= rawDataIn.size())
+				{
+					result &= populateWavePackets(rawDataIn, rawDataAddressIn, rawDataLengthIn);
+				}
+			}
+
+			return result;
+		}
+		bool rwsd::getDataEntryViews(const std::vector<unsigned char>& fileBodyIn, std::vector<dataInfoView>& viewsOut)
+		{
+			bool result = 0;
+
+			viewsOut.clear();
+			if (getFundamentalFromVec<unsigned long>(fileBodyIn, 0x00) == brsarHexTags::bht_RWSD)
+			{
+				result = rwsdDataSection::populateEntryViews(fileBodyIn, getFundamentalFromVec<unsigned long>(fileBodyIn, 0x10), viewsOut);
+			}
+
+			return result;
+		}
+		bool rwsd::populate(const brsarFileFileContents& fileContentsIn, bool populateWavePacketsIn)
+		{
+			bool result = 0;
+
+			if (fileContentsIn.getFileType() == brsarHexTags::bht_RWSD)
+			{
+				byteArray headerArr(fileContentsIn.header.data(), fileContentsIn.header.size());
+				if (populateWavePacketsIn)
+				{
+					byteArray dataArr(fileContentsIn.data.data(), fileContentsIn.data.size());
+					result = populate(headerArr, 0x00, dataArr, 0x00, dataArr.size());
+				}
+				else
+				{
+					// Skip copying the raw data entirely, only the DATA and WAVE sections get parsed.
+					result = populate(headerArr, 0x00, headerArr, ULONG_MAX, 0x00);
+				}
+			}
+
+			return result;
+		}
+
+		bool rwsd::populate(std::string filePathIn)
+		{
+			bool result = 0;
+
+			lava::byteArray fileArray(filePathIn);
+			if (fileArray.populated())
+			{
+				if (fileArray.getLong(0x00) == brsarHexTags::bht_RWSD)
+				{
+					unsigned long headerLength = fileArray.getLong(0x08);
+					if (fileArray.size() >= headerLength)
+					{
+						unsigned long dataAddress = headerLength;
+						labelSection = lablSection();
+						if (fileArray.size() > (headerLength + 0x08))
+						{
+							if (labelSection.populate(fileArray, headerLength))
+							{
+								dataAddress += labelSection.originalLength;
+							}
+						}
+						result = populate(fileArray, 0x00, fileArray, dataAddress, fileArray.size() - dataAddress);
+					}
+				}
+			}
+
+			return result;
+		}
+
+		unsigned long rwsd::getDataEntryIndex(const std::string& labelNameIn) const
+		{
+			unsigned long result = ULONG_MAX;
+
+			unsigned long labelIndex = labelSection.findLabelIndex(labelNameIn);
+			if (labelIndex != ULONG_MAX && labelSection.entries[labelIndex].dataOffset < dataSection.entries.size())
+			{
+				result = labelSection.entries[labelIndex].dataOffset;
+			}
+
+			return result;
+		}
+
+		bool rwsd::exportFileSection(std::ostream& destinationStream)
+		{
+			bool result = 0;
+
+			if (destinationStream.good())
+			{
+				result = 1;
+
+				// Write Header Data
+				unsigned long cachedDataSectionSize = dataSection.paddedSize();
+				unsigned long cachedWaveSectionSize = waveSection.paddedSize();
+				writeRawDataToStream(destinationStream, brsarHexTags::bht_RWSD); // Write RWSD Tag
+				writeRawDataToStream(destinationStream, endianType); // Write Big-Endian BOM
+				writeRawDataToStream(destinationStream, versionNumber); // Write Version
+				writeRawDataToStream(destinationStream, size()); // RWSD Length
+				writeRawDataToStream(destinationStream, unsigned short(getDATASectionOffset())); // Offset to first subsection
+				writeRawDataToStream(destinationStream, unsigned short(0x02)); // Write number of subsections
+				writeRawDataToStream(destinationStream, getDATASectionOffset()); // DATA Subsection Offset
+				writeRawDataToStream(destinationStream, getDATASectionSize()); // DATA Subsection Length
+				writeRawDataToStream(destinationStream, getWAVESectionOffset()); // WAVE Subsection Offset
+				writeRawDataToStream(destinationStream, getWAVESectionSize()); // WAVE Subsection Length
+
+				// Write Subsections
+				result &= dataSection.exportContents(destinationStream);
+				result &= waveSection.exportContents(destinationStream);
+			}
+
+			return result;
+		}
+		bool rwsd::exportRawDataSection(std::ostream& destinationStream)
+		{
+			return waveSection.exportRawDataSection(destinationStream);
+		}
+		std::vector<unsigned char> rwsd::fileSectionToVec()
+		{
+			std::vector<unsigned char> result;
+
+			std::stringstream tempStream(std::ios_base::in | std::ios_base::out | std::ios_base::binary);
+			if (exportFileSection(tempStream))
+			{
+				result = streamContentsToVec(tempStream);
+			}
+
+			return result;
+		}
+		std::vector<unsigned char> rwsd::rawDataSectionToVec()
+		{
+			std::vector<unsigned char> result;
+
+			std::stringstream tempStream(std::ios_base::in | std::ios_base::out | std::ios_base::binary);
+			if (exportRawDataSection(tempStream))
+			{
+				result = streamContentsToVec(tempStream);
+			}
+
+			return result;
+		}
+		dsp rwsd::exportWaveRawDataToDSP(unsigned long waveSectionIndex, unsigned long channelIndex)
+		{
+			return waveSection.exportWaveRawDataToDSP(waveSectionIndex, channelIndex);
+		}
+		bool rwsd::exportWaveRawDataToDSPs(unsigned long waveSectionIndex, std::vector<dsp>& dspsOut, unsigned long threadCount)
+		{
+			return waveSection.exportWaveRawDataToDSPs(waveSectionIndex, dspsOut, threadCount);
+		}
+		bool rwsd::exportWaveRawDataToDSPFiles(unsigned long waveSectionIndex, std::string outputPathBase, unsigned long threadCount)
+		{
+			return waveSection.exportWaveRawDataToDSPFiles(waveSectionIndex, outputPathBase, threadCount);
+		}
+		bool rwsd::exportWaveRawDataToWAV(unsigned long waveSectionIndex, wav& wavOut, unsigned long threadCount)
+		{
+			return waveSection.exportWaveRawDataToWAV(waveSectionIndex, wavOut, threadCount);
+		}
+		bool rwsd::exportWaveRawDataToWAV(unsigned long waveSectionIndex, std::string wavOutputPath, unsigned long threadCount)
+		{
+			return waveSection.exportWaveRawDataToWAV(waveSectionIndex, wavOutputPath, threadCount);
+		}
+
+		bool rwsd::updateWaveEntryDataLocations()
+		{
+			return waveSection.updateWaveEntryDataLocations();
+		}
+		waveInfo* rwsd::getWaveInfoAssociatedWithDataInfo(unsigned long dataSectionIndex)
+		{
+			waveInfo* result = nullptr;
+
+			if (dataSectionIndex < dataSection.entries.size())
+			{
+				unsigned long waveIndex = dataSection.entries[dataSectionIndex].ntWaveIndex;
+				if (waveIndex < waveSection.entries.size())
+				{
+					result = &waveSection.entries[waveIndex];
+				}
+			}
+
+			return result;
+		}
+		bool rwsd::summarize(std::ostream& output)
+		{
+			bool result = 0;
+
+			if (output.good() && address != UINT_MAX)
+			{
+				output << "RWSD Content Summary - lavaBRSARLib " << version << "\n";
+				output << "\nNote: In the following summarization, all addresses are relative to the start of the described RWSD file.\n";
+				output << "Additionally, any absolute Wave Content Address values assume the wave content block directly follows the WAVE section.\n";
+				output << "While this is always true of individual RWSD files produced with this library, it *is not guaranteed* in any other case!\n";
+				output << "\nStructure Overview:\n";
+				output << "\tTotal Length/End:\t0x" << lava::numToHexStringWithPadding(size(), 0x08) << " / 0x" << lava::numToHexStringWithPadding(size(), 0x08) << "\n";
+				output << "\tData Section Offset:\t0x" << lava::numToHexStringWithPadding(getDATASectionOffset(), 0x08) << "\n";
+				output << "\tData Section Length/End:\t0x" << lava::numToHexStringWithPadding(getDATASectionSize(), 0x08) << " / 0x" << lava::numToHexStringWithPadding(getDATASectionOffset() + getDATASectionSize(), 0x08) << "\n";
+				output << "\tData Entry Count:\t\t0x" << lava::numToHexStringWithPadding(dataSection.entries.size(), 0x04) << "\n";
+				output << "\tWave Section Offset:\t0x" << lava::numToHexStringWithPadding(getWAVESectionOffset(), 0x08) << "\n";
+				output << "\tWave Section Length/End:\t0x" << lava::numToHexStringWithPadding(getWAVESectionSize(), 0x08) << " / 0x" << lava::numToHexStringWithPadding(getWAVESectionOffset() + getWAVESectionSize(), 0x08) << "\n";
+				output << "\tWave Entry Count:\t\t0x" << lava::numToHexStringWithPadding(waveSection.entries.size(), 0x04) << "\n";
+				output << "\nEntry Summary:\n";
+
+				std::unordered_map<unsigned long, std::vector<unsigned long>> waveIndecesToReferrerDataIndeces{};
+
+				std::vector<dataInfo>* dataVecPtr = &dataSection.entries;
+				std::vector<waveInfo>* waveVecPtr = &waveSection.entries;
+				brawlReferenceVector* dataRefVecPtr = &dataSection.entryReferences;
+				std::vector<unsigned long> waveOffVec = waveSection.calculateOffsetVector();
+
+				unsigned long waveDataBaseAddress = getWAVESectionOffset() + getWAVESectionSize();
+
+				for (unsigned long u = 0; u < dataVecPtr->size(); u++)
+				{
+					dataInfo* currDataEntry = &(*dataVecPtr)[u];
+					output << "\tData Entry 0x" << lava::numToHexStringWithPadding(u, 0x04) << "\n";
+					output << "\t\tOffset / Address:\t0x" << lava::numToHexStringWithPadding(dataRefVecPtr->refs[u].address, 0x08) << " / 0x" << lava::numToHexStringWithPadding(getDATASectionOffset() + 0x08 + dataRefVecPtr->refs[u].address, 0x08) << "\n";
+					output << "\t\tAssociated Wave ID:\t0x" << lava::numToHexStringWithPadding(currDataEntry->ntWaveIndex, 0x04) << "\n";
+					if (currDataEntry->ntWaveIndex != ULONG_MAX)
+					{
+						auto emplaceResult = waveIndecesToReferrerDataIndeces.emplace(std::make_pair(currDataEntry->ntWaveIndex, std::vector<unsigned long>()));
+						if (emplaceResult.second)
+						{
+							waveInfo* currWaveEntry = &(*waveVecPtr)[currDataEntry->ntWaveIndex];
+							output << "\t\tWave Entry Offset / Address:\t0x" << lava::numToHexStringWithPadding(waveOffVec[currDataEntry->ntWaveIndex], 0x08) << " / 0x" << lava::numToHexStringWithPadding(getWAVESectionOffset() + waveOffVec[currDataEntry->ntWaveIndex], 0x08) << "\n";
+							output << "\t\tWave Contents Offset / Address:\t0x" << lava::numToHexStringWithPadding(currWaveEntry->dataLocation, 0x08) << " / 0x" << lava::numToHexStringWithPadding(waveDataBaseAddress + currWaveEntry->dataLocation, 0x08) << "\n";
+							output << "\t\tWave Contents Length / End:\t0x" << lava::numToHexStringWithPadding(currWaveEntry->getAudioLengthInBytes(), 0x04) << " / 0x" << lava::numToHexStringWithPadding(waveDataBaseAddress + currWaveEntry->dataLocation + currWaveEntry->getAudioLengthInBytes(), 0x08) << "\n";
+							emplaceResult.first->second.push_back(u);
+						}
+						else
+						{
+							output << "\t\tSkipping Wave Summary, see Data Entry 0x" << lava::numToHexStringWithPadding(emplaceResult.first->second.front(), 0x04) << "\n";
+							emplaceResult.first->second.push_back(u);
+						}
+					}
+				}
+				result = output.good();
+			}
+
+			return result;
+		}
+		bool rwsd::summarize(std::string filepath)
+		{
+			bool result = 0;
+
+			std::ofstream output(filepath, std::ios_base::out);
+			if (output.is_open())
+			{
+				result = summarize(output);
+			}
+
+			return result;
+		}
+
+		bool rwsd::overwriteWave(unsigned long waveSectionIndex, const waveInfo& waveInfoIn)
+		{
+			bool result = 0;
+
+			if (waveSectionIndex < waveSection.entries.size())
+			{
+				waveSection.entries[waveSectionIndex] = waveInfoIn;
+				result = updateWaveEntryDataLocations();
+			}
+
+			return result;
+		}
+		bool rwsd::overwriteAllWaves(const waveInfo waveInfoIn)
+		{
+			bool result = 0;
+
+			for (std::size_t i = 0; i < waveSection.entries.size(); i++)
+			{
+				waveSection.entries[i] = waveInfoIn;
+			}
+			result = updateWaveEntryDataLocations();
+
+			return result;
+		}
+		bool rwsd::overwriteWaveRawData(unsigned long waveSectionIndex, const std::vector<unsigned char>& rawDataIn)
+		{
+			return waveSection.overwriteWaveRawData(waveSectionIndex, rawDataIn);
+		}
+		bool rwsd::overwriteWaveRawDataWithDSP(unsigned long waveSectionIndex, const dsp& dspIn)
+		{
+			bool result = waveSection.overwriteWaveRawDataWithDSP(waveSectionIndex, dspIn);
+			// Imports can change the channel count, and with it the size of the wave's entry.
+			signalWAVESectionSizeChange();
+			return result;
+		}
+		bool rwsd::overwriteWaveRawDataWithDSP(unsigned long waveSectionIndex, std::string dspPathIn)
+		{
+			bool result = waveSection.overwriteWaveRawDataWithDSP(waveSectionIndex, dspPathIn);
+			signalWAVESectionSizeChange();
+			return result;
+		}
+		bool rwsd::overwriteWaveRawDataWithDSPs(unsigned long waveSectionIndex, const std::vector<dsp>& dspsIn)
+		{
+			bool result = waveSection.overwriteWaveRawDataWithDSPs(waveSectionIndex, dspsIn);
+			signalWAVESectionSizeChange();
+			return result;
+		}
+		bool rwsd::overwriteWaveRawDataWithDSPs(unsigned long waveSectionIndex, const std::vector<std::string>& dspPathsIn)
+		{
+			bool result = waveSection.overwriteWaveRawDataWithDSPs(waveSectionIndex, dspPathsIn);
+			signalWAVESectionSizeChange();
+			return result;
+		}
+		bool rwsd::overwriteWaveRawDataWithWAV(unsigned long waveSectionIndex, const wav& wavIn, unsigned long threadCount, unsigned char encodeModeIn, unsigned long targetSampleRateIn,
+			std::vector<gcADPCMEncodeReport>* reportsOut)
+		{
+			bool result = waveSection.overwriteWaveRawDataWithWAV(waveSectionIndex, wavIn, threadCount, encodeModeIn, targetSampleRateIn, reportsOut);
+			signalWAVESectionSizeChange();
+			return result;
+		}
+		bool rwsd::overwriteWaveRawDataWithWAV(unsigned long waveSectionIndex, std::string wavPathIn, unsigned long threadCount, unsigned char encodeModeIn, unsigned long targetSampleRateIn,
+			std::vector<gcADPCMEncodeReport>* reportsOut)
+		{
+			bool result = waveSection.overwriteWaveRawDataWithWAV(waveSectionIndex, wavPathIn, threadCount, encodeModeIn, targetSampleRateIn, reportsOut);
+			signalWAVESectionSizeChange();
+			return result;
+		}
+		bool rwsd::overwriteWaveRawDataWithWAVs(const std::vector<std::pair<unsigned long, std::string>>& waveIndicesToWAVPathsIn, unsigned long threadCount,
+			unsigned char encodeModeIn, unsigned long targetSampleRateIn, std::vector<char>* succeededOut, std::vector<std::vector<gcADPCMEncodeReport>>* reportsOut)
+		{
+			bool result = waveSection.overwriteWaveRawDataWithWAVs(waveIndicesToWAVPathsIn, threadCount, encodeModeIn, targetSampleRateIn, succeededOut, reportsOut);
+			signalWAVESectionSizeChange();
+			return result;
+		}
+
+		bool rwsd::createNewWaveEntry(const waveInfo& sourceWave, bool pushFront)
+		{
+			bool result = 1;
+
+			if (pushFront)
+			{
+				// Add entry to front of WAVE entry vec.
+				waveSection.waveEntryPushFront(sourceWave);
+				// Since we've added the entry to the front, the indices for every other sound have been shifted up by 1
+				// So we need to iterate through all the DATA entries and shift their indeces.
+				for (unsigned long i = 0; i < dataSection.entries.size(); i++)
+				{
+					dataSection.entries[i].ntWaveIndex++;
+				}
+				dataSection.rebuildWaveReferrerIndex();
+			}
+			else
+			{
+				// Add entry to back of WAVE entry vec.
+				waveSection.waveEntryPushBack(sourceWave);
+			}
+			// Recalculate WAVE entry data locations.
+			updateWaveEntryDataLocations();
+			signalWAVESectionSizeChange();
+
+			return result;
+		}
+		bool rwsd::createNewWaveEntries(const waveInfo sourceWave, unsigned long cloneCount, bool pushFront)
+		{
+			bool result = 1;
+
+			// Note that we can't take sourceWave as a reference, because if we take in an element from the vector as ref,
+			// then insert into the vector, we'll invalidate our reference.
+			// All of the new entries go in with a single insert, so the vector only grows (and shifts) once.
+			if (cloneCount > 0)
+			{
+				if (pushFront)
+				{
+					waveSection.waveEntriesPushFront(sourceWave, cloneCount);
+					// Every existing entry has been shifted up by cloneCount, so shift the DATA entries' indeces to match.
+					for (unsigned long i = 0; i < dataSection.entries.size(); i++)
+					{
+						dataSection.entries[i].ntWaveIndex += cloneCount;
+					}
+					dataSection.rebuildWaveReferrerIndex();
+				}
+				else
+				{
+					waveSection.waveEntriesPushBack(sourceWave, cloneCount);
+				}
+				// Recalculate WAVE entry data locations.
+				result = updateWaveEntryDataLocations();
+				signalWAVESectionSizeChange();
+			}
+
+			return result;
+		}
+		bool rwsd::grantDataEntryUniqueWave(unsigned long dataSectionIndex, const waveInfo& sourceWave, bool pushFront)
+		{
+			bool result = 0;
+
+			if (createNewWaveEntry(sourceWave, pushFront))
+			{
+				if (pushFront)
+				{
+					result = dataSection.setEntryWaveIndex(dataSectionIndex, 0);
+				}
+				else
+				{
+					result = dataSection.setEntryWaveIndex(dataSectionIndex, waveSection.entries.size() - 1);
+				}
+			}
+
+			return result;
+		}
+
+		bool rwsd::hollowOutWAVEEntry(unsigned long waveID)
+		{
+			bool result = 0;
+
+			if (waveSection.entries.size() > waveID)
+			{
+				result = 1;
+				waveSection.entries[waveID].hollowOut();
+			}
+
+			return result;
+		}
+		bool rwsd::cutDownWaveSection(unsigned long remainingWaveCount, bool zeroOutWaveContent)
+		{
+			bool result = 0;
+
+			if (remainingWaveCount > 0)
+			{
+				if (waveSection.entries.size() > remainingWaveCount)
+				{
+					waveSection.entries.resize(remainingWaveCount);
+				}
+				for (std::size_t i = 0; i < dataSection.entries.size(); i++)
+				{
+					if (dataSection.entries[i].ntWaveIndex >= remainingWaveCount)
+					{
+						dataSection.entries[i].ntWaveIndex = 0;
+					}
+				}
+				dataSection.rebuildWaveReferrerIndex();
+				if (zeroOutWaveContent)
+				{
+					for (std::size_t i = 0; i < waveSection.entries.size(); i++)
+					{
+						hollowOutWAVEEntry(i);
+					}
+				}
+				result = updateWaveEntryDataLocations();
+				signalDATASectionSizeChange();
+				signalWAVESectionSizeChange();
+			}
+
+			return result;
+		}
+
+		bool rwsd::removeRedirectedWaves(const std::vector<unsigned long>& waveRedirectsIn, unsigned long* removedWaveCountOut, unsigned long* bytesReclaimedOut)
+		{
+			bool result = 1;
+
+			unsigned long removedWaveCount = 0x00;
+			unsigned long bytesReclaimed = 0x00;
+
+			unsigned long bytesBefore = size();
+			std::vector<unsigned long> newWaveIndeces(waveSection.entries.size(), ULONG_MAX);
+			std::vector<waveInfo> keptWaves{};
+			for (unsigned long i = 0; i < waveSection.entries.size(); i++)
+			{
+				waveInfo* currWave = &waveSection.entries[i];
+				bytesBefore += currWave->packetContents.body.size() + currWave->packetContents.padding.size();
+				if (waveRedirectsIn[i] == i)
+				{
+					newWaveIndeces[i] = keptWaves.size();
+					keptWaves.push_back(std::move(*currWave));
+				}
+			}
+			removedWaveCount = waveSection.entries.size() - keptWaves.size();
+			waveSection.entries = std::move(keptWaves);
+
+			if (removedWaveCount > 0)
+			{
+				// Out of range indeces referenced nothing to begin with, so leave them be.
+				for (unsigned long i = 0; i < dataSection.entries.size(); i++)
+				{
+					dataInfo* currEntry = &dataSection.entries[i];
+					if (currEntry->ntWaveIndex < waveRedirectsIn.size())
+					{
+						unsigned long redirectedIndex = waveRedirectsIn[currEntry->ntWaveIndex];
+						currEntry->ntWaveIndex = (redirectedIndex < newWaveIndeces.size()) ? newWaveIndeces[redirectedIndex] : 0x00;
+					}
+				}
+				dataSection.rebuildWaveReferrerIndex();
+				result = updateWaveEntryDataLocations();
+				signalWAVESectionSizeChange();
+
+				unsigned long bytesAfter = size();
+				for (unsigned long i = 0; i < waveSection.entries.size(); i++)
+				{
+					bytesAfter += waveSection.entries[i].packetContents.body.size() + waveSection.entries[i].packetContents.padding.size();
+				}
+				if (bytesBefore > bytesAfter)
+				{
+					bytesReclaimed = bytesBefore - bytesAfter;
+				}
+			}
+
+			if (removedWaveCountOut != nullptr)
+			{
+				*removedWaveCountOut = removedWaveCount;
+			}
+			if (bytesReclaimedOut != nullptr)
+			{
+				*bytesReclaimedOut = bytesReclaimed;
+			}
+
+			return result;
+		}
+		bool rwsd::removeUnreferencedWaves(unsigned long* removedWaveCountOut, unsigned long* bytesReclaimedOut)
+		{
+			bool result = 0;
+
+			if (!waveSection.entries.empty())
+			{
+				bool anyReferenced = 0;
+				std::vector<unsigned long> waveRedirects(waveSection.entries.size(), ULONG_MAX);
+				for (unsigned long i = 0; i < waveSection.entries.size(); i++)
+				{
+					if (dataSection.getWaveReferenceCount(i) > 0)
+					{
+						waveRedirects[i] = i;
+						anyReferenced = 1;
+					}
+				}
+				// Don't leave the RWSD without any waves at all.
+				if (!anyReferenced)
+				{
+					waveRedirects[0] = 0x00;
+				}
+				result = removeRedirectedWaves(waveRedirects, removedWaveCountOut, bytesReclaimedOut);
+			}
+			else
+			{
+				// Nothing to prune isn't a failure.
+				result = 1;
+				if (removedWaveCountOut != nullptr)
+				{
+					*removedWaveCountOut = 0x00;
+				}
+				if (bytesReclaimedOut != nullptr)
+				{
+					*bytesReclaimedOut = 0x00;
+				}
+			}
+
+			return result;
+		}
+		bool rwsd::mergeDuplicateWaves(unsigned long* mergedWaveCountOut, unsigned long* bytesReclaimedOut, bool dryRun)
+		{
+			bool result = 0;
+
+			unsigned long mergedWaveCount = 0x00;
+			unsigned long bytesReclaimed = 0x00;
+			if (!waveSection.entries.empty())
+			{
+				result = 1;
+
+				// Key each wave on a hash of its audio data plus its exported info block (with the data location left out),
+				// which covers the encoding, sample rate, loop info and ADPCM coefficients.
+				MD5 md5Object;
+				std::vector<std::vector<unsigned char>> infoBlocks(waveSection.entries.size());
+				std::unordered_map<std::string, std::vector<unsigned long>> hashesToWaveIndeces{};
+				std::vector<unsigned long> waveRedirects(waveSection.entries.size(), ULONG_MAX);
+				for (unsigned long i = 0; i < waveSection.entries.size(); i++)
+				{
+					const waveInfo* currWave = &waveSection.entries[i];
+					waveInfo infoOnly;
+					infoOnly.copyOverWaveInfoProperties(*currWave);
+					std::stringstream tempStream(std::ios_base::in | std::ios_base::out | std::ios_base::binary);
+					infoOnly.exportContents(tempStream);
+					infoBlocks[i] = streamContentsToVec(tempStream);
+
+					std::string waveHash = md5Object(infoBlocks[i].data(), infoBlocks[i].size());
+					waveHash += md5Object(currWave->packetContents.body.data(), currWave->packetContents.body.size());
+
+					// Confirm the match byte-for-byte rather than trusting the hash alone.
+					std::vector<unsigned long>* candidates = &hashesToWaveIndeces[waveHash];
+					for (std::size_t u = 0; waveRedirects[i] == ULONG_MAX && u < candidates->size(); u++)
+					{
+						const waveInfo* candidateWave = &waveSection.entries[(*candidates)[u]];
+						if (infoBlocks[(*candidates)[u]] == infoBlocks[i] && candidateWave->packetContents.body == currWave->packetContents.body)
+						{
+							waveRedirects[i] = (*candidates)[u];
+						}
+					}
+					if (waveRedirects[i] == ULONG_MAX)
+					{
+						waveRedirects[i] = i;
+						candidates->push_back(i);
+					}
+					else
+					{
+						mergedWaveCount++;
+						bytesReclaimed += currWave->size() + sizeof(unsigned long) + currWave->packetContents.body.size() + currWave->packetContents.padding.size();
+					}
+				}
+
+				if (!dryRun && mergedWaveCount > 0)
+				{
+					result = removeRedirectedWaves(waveRedirects, &mergedWaveCount, &bytesReclaimed);
+				}
+			}
+
+			if (mergedWaveCountOut != nullptr)
+			{
+				*mergedWaveCountOut = mergedWaveCount;
+			}
+			if (bytesReclaimedOut != nullptr)
+			{
+				*bytesReclaimedOut = bytesReclaimed;
+			}
+
+			return result;
+		}
+
+		/* RWSD */
+
+		/* RBNK */
+
+		bool rbnkInstParam::populate(const lava::byteArray& bodyIn, std::size_t addressIn)
+		{
+			bool result = 0;
+
+			if (bodyIn.populated() && (addressIn + size()) <= bodyIn.size())
+			{
+				std::size_t cursor = addressIn;
+				waveIndex = bodyIn.getLong(cursor, &cursor);
+				attack = bodyIn.getChar(cursor, &cursor);
+				decay = bodyIn.getChar(cursor, &cursor);
+				sustain = bodyIn.getChar(cursor, &cursor);
+				release = bodyIn.getChar(cursor, &cursor);
+				hold = bodyIn.getChar(cursor, &cursor);
+				waveDataLocationType = bodyIn.getChar(cursor, &cursor);
+				noteOffType = bodyIn.getChar(cursor, &cursor);
+				alternateAssign = bodyIn.getChar(cursor, &cursor);
+				originalKey = bodyIn.getChar(cursor, &cursor);
+				volume = bodyIn.getChar(cursor, &cursor);
+				pan = bodyIn.getChar(cursor, &cursor);
+				surroundPan = bodyIn.getChar(cursor, &cursor);
+				pitch = bodyIn.getFloat(cursor, &cursor);
+				lfoTableRef = brawlReference(bodyIn.getLLong(cursor, &cursor));
+				graphEnvTableRef = brawlReference(bodyIn.getLLong(cursor, &cursor));
+				randomizerTableRef = brawlReference(bodyIn.getLLong(cursor, &cursor));
+				reserved = bodyIn.getLong(cursor, &cursor);
+
+				result = 1;
+			}
+
+			return result;
+		}
+		bool rbnkInstParam::referencesTables() const
+		{
+			return lfoTableRef.getHex() != 0x00 || graphEnvTableRef.getHex() != 0x00 || randomizerTableRef.getHex() != 0x00;
+		}
+		bool rbnkInstParam::exportContents(std::ostream& destinationStream) const
+		{
+			bool result = 0;
+
+			if (destinationStream.good())
+			{
+				lava::writeRawDataToStream(destinationStream, waveIndex);
+				lava::writeRawDataToStream(destinationStream, attack);
+				lava::writeRawDataToStream(destinationStream, decay);
+				lava::writeRawDataToStream(destinationStream, sustain);
+				lava::writeRawDataToStream(destinationStream, release);
+				lava::writeRawDataToStream(destinationStream, hold);
+				lava::writeRawDataToStream(destinationStream, waveDataLocationType);
+				lava::writeRawDataToStream(destinationStream, noteOffType);
+				lava::writeRawDataToStream(destinationStream, alternateAssign);
+				lava::writeRawDataToStream(destinationStream, originalKey);
+				lava::writeRawDataToStream(destinationStream, volume);
+				lava::writeRawDataToStream(destinationStream, pan);
+				lava::writeRawDataToStream(destinationStream, surroundPan);
+				lava::writeRawDataToStream(destinationStream, pitch);
+				lava::writeRawDataToStream(destinationStream, lfoTableRef.getHex());
+				lava::writeRawDataToStream(destinationStream, graphEnvTableRef.getHex());
+				lava::writeRawDataToStream(destinationStream, randomizerTableRef.getHex());
+				lava::writeRawDataToStream(destinationStream, reserved);
+				result = destinationStream.good();
+			}
+
+			return result;
+		}
+
+		unsigned char rbnkRegionRef::getRegionType() const
+		{
+			return (addressType >> 0x10) & 0xFF;
+		}
+
+		unsigned long rbnkRegionNode::size() const
+		{
+			unsigned long result = 0x00;
+
+			switch (regionType)
+			{
+				case rbnkRegionTypes::rrt_INST_PARAM:
+				{
+					result = rbnkInstParam::size();
+					break;
+				}
+				case rbnkRegionTypes::rrt_RANGE_TABLE:
+				{
+					result = padLengthTo(sizeof(unsigned char) + rangeKeys.size(), 0x04); // Entry Count + Keys
+					result += children.size() * brawlReference::size();
+					break;
+				}
+				case rbnkRegionTypes::rrt_INDEX_TABLE:
+				{
+					result = sizeof(indexMin) + sizeof(indexMax) + sizeof(indexReserved);
+					result += children.size() * brawlReference::size();
+					break;
+				}
+				default:
+				{
+					break;
+				}
+			}
+
+			return result;
+		}
+		bool rbnkRegionNode::exportContents(std::ostream& destinationStream, const std::vector<unsigned long>& nodeOffsetsIn) const
+		{
+			bool result = 0;
+
+			if (destinationStream.good())
+			{
+				switch (regionType)
+				{
+					case rbnkRegionTypes::rrt_INST_PARAM:
+					{
+						instParam.exportContents(destinationStream);
+						break;
+					}
+					case rbnkRegionTypes::rrt_RANGE_TABLE:
+					{
+						lava::writeRawDataToStream(destinationStream, unsigned char(rangeKeys.size()));
+						destinationStream.write((const char*)rangeKeys.data(), rangeKeys.size());
+						std::vector<char> padding(padLengthTo(sizeof(unsigned char) + rangeKeys.size(), 0x04) - (sizeof(unsigned char) + rangeKeys.size()), 0x00);
+						destinationStream.write(padding.data(), padding.size());
+						break;
+					}
+					case rbnkRegionTypes::rrt_INDEX_TABLE:
+					{
+						lava::writeRawDataToStream(destinationStream, indexMin);
+						lava::writeRawDataToStream(destinationStream, indexMax);
+						lava::writeRawDataToStream(destinationStream, indexReserved);
+						break;
+					}
+					default:
+					{
+						break;
+					}
+				}
+				if (regionType == rbnkRegionTypes::rrt_RANGE_TABLE || regionType == rbnkRegionTypes::rrt_INDEX_TABLE)
+				{
+					for (std::size_t i = 0; i < children.size(); i++)
+					{
+						const rbnkRegionRef* currChild = &children[i];
+						lava::writeRawDataToStream(destinationStream, currChild->addressType);
+						lava::writeRawDataToStream(destinationStream, (currChild->nodeIndex != ULONG_MAX) ? nodeOffsetsIn[currChild->nodeIndex] : currChild->address);
+					}
+				}
+				result = destinationStream.good();
+			}
+
+			return result;
+		}
+
+		unsigned long rbnkDataSection::size() const
+		{
+			unsigned long result = 0x00;
+
+			result += sizeof(unsigned long); // Size of DATA Tag
+			result += sizeof(unsigned long); // Size of Length Field
+			result += calcRefVecSize(instruments.size()); // Length of the Instrument Ref Vec
+			for (std::size_t i = 0; i < nodes.size(); i++)
+			{
+				result += nodes[i].size(); // Size of Each Node
+			}
+
+			return result;
+		}
+		unsigned long rbnkDataSection::paddedSize(unsigned long padTo) const
+		{
+			return padLengthTo(size(), padTo);
+		}
+		std::vector<unsigned long> rbnkDataSection::calculateNodeOffsetVector() const
+		{
+			std::vector<unsigned long> result{};
+
+			unsigned long calculatedNodeOffset = calcRefVecSize(instruments.size());
+			result.reserve(nodes.size());
+			for (std::size_t i = 0; i < nodes.size(); i++)
+			{
+				result.push_back(calculatedNodeOffset);
+				calculatedNodeOffset += nodes[i].size();
+			}
+
+			return result;
+		}
+		const rbnkInstParam* rbnkDataSection::findInstParam(unsigned long instrumentIndex, unsigned char key, unsigned char velocity) const
+		{
+			const rbnkInstParam* result = nullptr;
+
+			if (instrumentIndex < instruments.size())
+			{
+				unsigned long currNodeIndex = instruments[instrumentIndex].nodeIndex;
+				// The first table level splits by key, and the second by velocity.
+				for (unsigned long depth = 0; result == nullptr && currNodeIndex < nodes.size() && depth <= 2; depth++)
+				{
+					const rbnkRegionNode* currNode = &nodes[currNodeIndex];
+					unsigned char value = (depth == 0) ? key : velocity;
+					currNodeIndex = ULONG_MAX;
+					switch (currNode->regionType)
+					{
+						case rbnkRegionTypes::rrt_INST_PARAM:
+						{
+							result = &currNode->instParam;
+							break;
+						}
+						case rbnkRegionTypes::rrt_RANGE_TABLE:
+						{
+							for (std::size_t i = 0; i < currNode->rangeKeys.size() && i < currNode->children.size(); i++)
+							{
+								if (value <= currNode->rangeKeys[i])
+								{
+									currNodeIndex = currNode->children[i].nodeIndex;
+									break;
+								}
+							}
+							break;
+						}
+						case rbnkRegionTypes::rrt_INDEX_TABLE:
+						{
+							if (value >= currNode->indexMin && std::size_t(value - currNode->indexMin) < currNode->children.size())
+							{
+								currNodeIndex = currNode->children[value - currNode->indexMin].nodeIndex;
+							}
+							break;
+						}
+						default:
+						{
+							break;
+						}
+					}
+				}
+			}
+
+			return result;
+		}
+		unsigned long rbnkDataSection::getWaveReferenceCount(unsigned long waveIndexIn) const
+		{
+			unsigned long result = 0;
+
+			for (std::size_t i = 0; i < nodes.size(); i++)
+			{
+				if (nodes[i].regionType == rbnkRegionTypes::rrt_INST_PARAM && nodes[i].instParam.waveIndex == waveIndexIn)
+				{
+					result++;
+				}
+			}
+
+			return result;
+		}
+		unsigned long rbnkDataSection::populateNode(const lava::byteArray& bodyIn, const brawlReference& referenceIn, std::unordered_map<unsigned long, unsigned long>& addressesToNodeIndeces)
+		{
+			unsigned long result = ULONG_MAX;
+
+			unsigned long nodeAddress = address + 0x08 + referenceIn.getAddress();
+			auto findResult = addressesToNodeIndeces.find(nodeAddress);
+			if (findResult != addressesToNodeIndeces.end())
+			{
+				result = findResult->second;
+			}
+			else if (nodeAddress < bodyIn.size())
+			{
+				result = nodes.size();
+				addressesToNodeIndeces[nodeAddress] = result;
+				nodes.push_back(rbnkRegionNode());
+				nodes.back().address = nodeAddress;
+				nodes.back().regionType = (referenceIn.addressType >> 0x10) & 0xFF;
+
+				// Children are populated after the node itself is in place, so they can't invalidate it while it's being filled in.
+				std::vector<brawlReference> childReferences{};
+				switch (nodes.back().regionType)
+				{
+					case rbnkRegionTypes::rrt_INST_PARAM:
+					{
+						nodes.back().instParam.populate(bodyIn, nodeAddress);
+						break;
+					}
+					case rbnkRegionTypes::rrt_RANGE_TABLE:
+					{
+						unsigned long entryCount = bodyIn.getChar(nodeAddress);
+						nodes.back().rangeKeys = bodyIn.getBytes(entryCount, nodeAddress + 0x01);
+						unsigned long cursor = nodeAddress + padLengthTo(sizeof(unsigned char) + entryCount, 0x04);
+						for (unsigned long i = 0; i < entryCount; i++)
+						{
+							childReferences.push_back(brawlReference(bodyIn.getLLong(cursor)));
+							cursor += brawlReference::size();
+						}
+						break;
+					}
+					case rbnkRegionTypes::rrt_INDEX_TABLE:
+					{
+						nodes.back().indexMin = bodyIn.getChar(nodeAddress);
+						nodes.back().indexMax = bodyIn.getChar(nodeAddress + 0x01);
+						nodes.back().indexReserved = bodyIn.getShort(nodeAddress + 0x02);
+						unsigned long cursor = nodeAddress + 0x04;
+						for (unsigned long i = nodes.back().indexMin; i <= nodes.back().indexMax; i++)
+						{
+							childReferences.push_back(brawlReference(bodyIn.getLLong(cursor)));
+							cursor += brawlReference::size();
+						}
+						break;
+					}
+					default:
+					{
+						break;
+					}
+				}
+
+				std::vector<rbnkRegionRef> children(childReferences.size());
+				for (std::size_t i = 0; i < childReferences.size(); i++)
+				{
+					populateRef(bodyIn, childReferences[i], children[i], addressesToNodeIndeces);
+				}
+				nodes[result].children = std::move(children);
+			}
+
+			return result;
+		}
+		void rbnkDataSection::populateRef(const lava::byteArray& bodyIn, const brawlReference& referenceIn, rbnkRegionRef& refOut, std::unordered_map<unsigned long, unsigned long>& addressesToNodeIndeces)
+		{
+			refOut.addressType = referenceIn.addressType;
+			refOut.address = referenceIn.address;
+			refOut.nodeIndex = ULONG_MAX;
+
+			unsigned char regionType = refOut.getRegionType();
+			if (referenceIn.isOffset() && regionType >= rbnkRegionTypes::rrt_INST_PARAM && regionType <= rbnkRegionTypes::rrt_INDEX_TABLE)
+			{
+				refOut.nodeIndex = populateNode(bodyIn, referenceIn, addressesToNodeIndeces);
+			}
+		}
+		bool rbnkDataSection::populate(const lava::byteArray& bodyIn, std::size_t addressIn)
+		{
+			bool result = 0;
+
+			if (bodyIn.populated() && bodyIn.getLong(addressIn) == brsarHexTags::bht_SUBF_DATA)
+			{
+				address = addressIn;
+				originalLength = bodyIn.getLong(addressIn + 0x04);
+				instruments.clear();
+				nodes.clear();
+
+				brawlReferenceVector instrumentReferences;
+				instrumentReferences.populate(bodyIn, addressIn + 0x08);
+				std::unordered_map<unsigned long, unsigned long> addressesToNodeIndeces{};
+				instruments.resize(instrumentReferences.refs.size());
+				for (std::size_t i = 0; i < instrumentReferences.refs.size(); i++)
+				{
+					populateRef(bodyIn, instrumentReferences.refs[i], instruments[i], addressesToNodeIndeces);
+				}
+
+				// Nodes were found depth-first; put the pool back in file order so exports lay them out the way they were.
+				std::vector<unsigned long> sortedNodeIndeces(nodes.size());
+				for (std::size_t i = 0; i < sortedNodeIndeces.size(); i++)
+				{
+					sortedNodeIndeces[i] = i;
+				}
+				std::sort(sortedNodeIndeces.begin(), sortedNodeIndeces.end(), [this](unsigned long a, unsigned long b) { return nodes[a].address < nodes[b].address; });
+				std::vector<unsigned long> oldIndecesToNewIndeces(nodes.size());
+				std::vector<rbnkRegionNode> sortedNodes(nodes.size());
+				for (std::size_t i = 0; i < sortedNodeIndeces.size(); i++)
+				{
+					oldIndecesToNewIndeces[sortedNodeIndeces[i]] = i;
+					sortedNodes[i] = std::move(nodes[sortedNodeIndeces[i]]);
+				}
+				nodes = std::move(sortedNodes);
+				for (std::size_t i = 0; i < instruments.size(); i++)
+				{
+					if (instruments[i].nodeIndex != ULONG_MAX)
+					{
+						instruments[i].nodeIndex = oldIndecesToNewIndeces[instruments[i].nodeIndex];
+					}
+				}
+				for (std::size_t i = 0; i < nodes.size(); i++)
+				{
+					for (std::size_t u = 0; u < nodes[i].children.size(); u++)
+					{
+						rbnkRegionRef* currChild = &nodes[i].children[u];
+						if (currChild->nodeIndex != ULONG_MAX)
+						{
+							currChild->nodeIndex = oldIndecesToNewIndeces[currChild->nodeIndex];
+						}
+					}
+				}
+
+				result = 1;
+			}
+
+			return result;
+		}
+		bool rbnkDataSection::exportContents(std::ostream& destinationStream) const
+		{
+			bool result = 0;
+
+			// Nodes are laid out afresh on export, which would leave any table references pointing at whatever lands at their old offsets.
+			bool tablesReferenced = 0;
+			for (std::size_t i = 0; !tablesReferenced && i < nodes.size(); i++)
+			{
+				tablesReferenced = nodes[i].regionType == rbnkRegionTypes::rrt_INST_PARAM && nodes[i].instParam.referencesTables();
+			}
+			if (tablesReferenced)
+			{
+				std::cerr << "[ERROR] Unable to export RBNK DATA section: an instrument parameter references an LFO, envelope or randomizer table, which can't be relocated.\n";
+			}
+			else if (destinationStream.good())
+			{
+				unsigned long initialStreamPos = destinationStream.tellp();
+				unsigned long expectedLength = paddedSize();
+				std::vector<unsigned long> nodeOffsets = calculateNodeOffsetVector();
+
+				lava::writeRawDataToStream(destinationStream, brsarHexTags::bht_SUBF_DATA);
+				lava::writeRawDataToStream(destinationStream, expectedLength);
+				lava::writeRawDataToStream(destinationStream, unsigned long(instruments.size()));
+				for (std::size_t i = 0; i < instruments.size(); i++)
+				{
+					lava::writeRawDataToStream(destinationStream, instruments[i].addressType);
+					lava::writeRawDataToStream(destinationStream, (instruments[i].nodeIndex != ULONG_MAX) ? nodeOffsets[instruments[i].nodeIndex] : instruments[i].address);
+				}
+				for (std::size_t i = 0; i < nodes.size(); i++)
+				{
+					nodes[i].exportContents(destinationStream, nodeOffsets);
+				}
+
+				unsigned long finalStreamPos = destinationStream.tellp();
+				unsigned long lengthOfExport = finalStreamPos - initialStreamPos;
+				if (lengthOfExport != expectedLength)
+				{
+					if (lengthOfExport < expectedLength)
+					{
+						std::vector<char> padding(expectedLength - lengthOfExport, 0x00);
+						destinationStream.write(padding.data(), padding.size());
+					}
+				}
+				result = destinationStream.good();
+			}
+			return result;
+		}
+
+		unsigned long rbnk::size()
+		{
+			unsigned long result = 0x00;
+
+			result =
+				0x20 // Header Length
+				+ getDATASectionSize() // DATA Section Size
+				+ getWAVESectionSize(); // WAVE Section Size
+
+			return result;
+		}
+		void rbnk::signalDATASectionSizeChange()
+		{
+			dataSectionCachedSize = ULONG_MAX;
+		}
+		void rbnk::signalWAVESectionSizeChange()
+		{
+			waveSectionCachedSize = ULONG_MAX;
+		}
+		unsigned long rbnk::getDATASectionSize()
+		{
+			if (dataSectionCachedSize == ULONG_MAX)
+			{
+				dataSectionCachedSize = dataSection.paddedSize();
+			}
+			return dataSectionCachedSize;
+		}
+		unsigned long rbnk::getWAVESectionSize()
+		{
+			if (waveSectionCachedSize == ULONG_MAX)
+			{
+				waveSectionCachedSize = waveSection.paddedSize();
+			}
+			return waveSectionCachedSize;
+		}
+		unsigned long rbnk::getDATASectionOffset()
+		{
+			return 0x20;
+		}
+		unsigned long rbnk::getWAVESectionOffset()
+		{
+			return getDATASectionOffset() + getDATASectionSize();
+		}
+
+		bool rbnk::populate(const byteArray& fileBodyIn, unsigned long fileBodyAddressIn, const byteArray& rawDataIn, unsigned long rawDataAddressIn, unsigned long rawDataLengthIn)
+		{
+			bool result = 0;
+
+			if (fileBodyIn.getLong(fileBodyAddressIn) == brsarHexTags::bht_RBNK)
+			{
+				address = fileBodyAddressIn;
+
+				endianType = fileBodyIn.getShort(fileBodyAddressIn + 0x04);
+				versionNumber = fileBodyIn.getShort(fileBodyAddressIn + 0x06);
+				unsigned long dataSectionOffset = fileBodyIn.getLong(fileBodyAddressIn + 0x10);
+				unsigned long waveSectionOffset = fileBodyIn.getLong(fileBodyAddressIn + 0x18);
+
+				result = dataSection.populate(fileBodyIn, fileBodyAddressIn + dataSectionOffset);
+				result &= waveSection.populate(fileBodyIn, fileBodyAddressIn + waveSectionOffset);
+				if (result && !waveSection.entries.empty() && rawDataAddressIn != ULONG_MAX && (rawDataAddressIn + rawDataLengthIn) <= rawDataIn.size())
+				{
+					result &= waveSection.populateWavePackets(rawDataIn, rawDataAddressIn, rawDataLengthIn);
+				}
+				signalDATASectionSizeChange();
+				signalWAVESectionSizeChange();
+			}
+
+			return result;
+		}
+		bool rbnk::populate(const brsarFileFileContents& fileContentsIn, bool populateWavePacketsIn)
+		{
+			bool result = 0;
+
+			if (fileContentsIn.getFileType() == brsarHexTags::bht_RBNK)
+			{
+				byteArray headerArr(fileContentsIn.header.data(), fileContentsIn.header.size());
+				if (populateWavePacketsIn)
+				{
+					byteArray dataArr(fileContentsIn.data.data(), fileContentsIn.data.size());
+					result = populate(headerArr, 0x00, dataArr, 0x00, dataArr.size());
+				}
+				else
+				{
+					result = populate(headerArr, 0x00, headerArr, ULONG_MAX, 0x00);
+				}
+			}
+
+			return result;
+		}
+		bool rbnk::populate(std::string filePathIn)
+		{
+			bool result = 0;
+
+			lava::byteArray fileArray(filePathIn);
+			if (fileArray.populated())
+			{
+				if (fileArray.getLong(0x00) == brsarHexTags::bht_RBNK)
+				{
+					unsigned long headerLength = fileArray.getLong(0x08);
+					if (fileArray.size() >= headerLength)
+					{
+						unsigned long dataAddress = headerLength;
+						labelSection = lablSection();
+						if (fileArray.size() > (headerLength + 0x08))
+						{
+							if (labelSection.populate(fileArray, headerLength))
+							{
+								dataAddress += labelSection.originalLength;
+							}
+						}
+						result = populate(fileArray, 0x00, fileArray, dataAddress, fileArray.size() - dataAddress);
+					}
+				}
+			}
+
+			return result;
+		}
+
+		bool rbnk::exportFileSection(std::ostream& destinationStream)
+		{
+			bool result = 0;
+
+			if (destinationStream.good())
+			{
+				result = 1;
+
+				// Write Header Data
+				writeRawDataToStream(destinationStream, brsarHexTags::bht_RBNK); // Write RBNK Tag
+				writeRawDataToStream(destinationStream, endianType); // Write Big-Endian BOM
+				writeRawDataToStream(destinationStream, versionNumber); // Write Version
+				writeRawDataToStream(destinationStream, size()); // RBNK Length
+				writeRawDataToStream(destinationStream, unsigned short(getDATASectionOffset())); // Offset to first subsection
+				writeRawDataToStream(destinationStream, unsigned short(0x02)); // Write number of subsections
+				writeRawDataToStream(destinationStream, getDATASectionOffset()); // DATA Subsection Offset
+				writeRawDataToStream(destinationStream, getDATASectionSize()); // DATA Subsection Length
+				writeRawDataToStream(destinationStream, getWAVESectionOffset()); // WAVE Subsection Offset
+				writeRawDataToStream(destinationStream, getWAVESectionSize()); // WAVE Subsection Length
+
+				// Write Subsections
+				result &= dataSection.exportContents(destinationStream);
+				result &= waveSection.exportContents(destinationStream);
+			}
+
+			return result;
+		}
+		bool rbnk::exportRawDataSection(std::ostream& destinationStream)
+		{
+			return waveSection.exportRawDataSection(destinationStream);
+		}
+		std::vector<unsigned char> rbnk::fileSectionToVec()
+		{
+			std::vector<unsigned char> result;
+
+			std::stringstream tempStream(std::ios_base::in | std::ios_base::out | std::ios_base::binary);
+			if (exportFileSection(tempStream))
+			{
+				result = streamContentsToVec(tempStream);
+			}
+
+			return result;
+		}
+		std::vector<unsigned char> rbnk::rawDataSectionToVec()
+		{
+			std::vector<unsigned char> result;
+
+			std::stringstream tempStream(std::ios_base::in | std::ios_base::out | std::ios_base::binary);
+			if (exportRawDataSection(tempStream))
+			{
+				result = streamContentsToVec(tempStream);
+			}
+
+			return result;
+		}
+		dsp rbnk::exportWaveRawDataToDSP(unsigned long waveSectionIndex, unsigned long channelIndex)
+		{
+			return waveSection.exportWaveRawDataToDSP(waveSectionIndex, channelIndex);
+		}
+		bool rbnk::exportWaveRawDataToWAV(unsigned long waveSectionIndex, wav& wavOut, unsigned long threadCount)
+		{
+			return waveSection.exportWaveRawDataToWAV(waveSectionIndex, wavOut, threadCount);
+		}
+		bool rbnk::exportWaveRawDataToWAV(unsigned long waveSectionIndex, std::string wavOutputPath, unsigned long threadCount)
+		{
+			return waveSection.exportWaveRawDataToWAV(waveSectionIndex, wavOutputPath, threadCount);
+		}
+
+		bool rbnk::summarizeRegion(std::ostream& output, const rbnkRegionRef& refIn, const std::vector<unsigned long>& nodeOffsetsIn, unsigned long depth)
+		{
+			bool result = 0;
+
+			std::string indent(depth + 2, '\t');
+			if (refIn.nodeIndex >= dataSection.nodes.size())
+			{
+				output << indent << "(No Region)\n";
+				result = output.good();
+			}
+			// Region trees only go as deep as instrument -> key -> velocity; anything deeper is malformed (or circular).
+			else if (depth <= 3)
+			{
+				result = 1;
+				const rbnkRegionNode* currNode = &dataSection.nodes[refIn.nodeIndex];
+				unsigned long nodeAddress = getDATASectionOffset() + 0x08 + nodeOffsetsIn[refIn.nodeIndex];
+				switch (currNode->regionType)
+				{
+					case rbnkRegionTypes::rrt_INST_PARAM:
+					{
+						const rbnkInstParam* currParam = &currNode->instParam;
+						output << indent << "Instrument Params @ 0x" << lava::numToHexStringWithPadding(nodeAddress, 0x08) << ": Wave ID 0x" << lava::numToHexStringWithPadding(currParam->waveIndex, 0x04)
+							<< ", Original Key " << lava::numToDecStringWithPadding(currParam->originalKey, 0x00)
+							<< ", Volume " << lava::numToDecStringWithPadding(currParam->volume, 0x00)
+							<< ", Pan " << lava::numToDecStringWithPadding(currParam->pan, 0x00)
+							<< ", Note Off Type " << lava::numToDecStringWithPadding(currParam->noteOffType, 0x00)
+							<< ", Alternate Assign " << lava::numToDecStringWithPadding(currParam->alternateAssign, 0x00) << "\n";
+						break;
+					}
+					case rbnkRegionTypes::rrt_RANGE_TABLE:
+					{
+						output << indent << "Range Table @ 0x" << lava::numToHexStringWithPadding(nodeAddress, 0x08) << " (" << currNode->children.size() << " Regions)\n";
+						unsigned long lowerBound = 0x00;
+						for (std::size_t i = 0; result && i < currNode->children.size() && i < currNode->rangeKeys.size(); i++)
+						{
+							output << indent << "\t" << ((depth == 0) ? "Keys " : "Velocities ") << lava::numToDecStringWithPadding(lowerBound, 0x00) << " - " << lava::numToDecStringWithPadding(currNode->rangeKeys[i], 0x00) << ":\n";
+							result &= summarizeRegion(output, currNode->children[i], nodeOffsetsIn, depth + 1);
+							lowerBound = currNode->rangeKeys[i] + 1;
+						}
+						break;
+					}
+					case rbnkRegionTypes::rrt_INDEX_TABLE:
+					{
+						output << indent << "Index Table @ 0x" << lava::numToHexStringWithPadding(nodeAddress, 0x08) << " (" << currNode->children.size() << " Regions)\n";
+						for (std::size_t i = 0; result && i < currNode->children.size(); i++)
+						{
+							output << indent << "\t" << ((depth == 0) ? "Key " : "Velocity ") << lava::numToDecStringWithPadding(currNode->indexMin + i, 0x00) << ":\n";
+							result &= summarizeRegion(output, currNode->children[i], nodeOffsetsIn, depth + 1);
+						}
+						break;
+					}
+					default:
+					{
+						break;
+					}
+				}
+				result &= output.good();
+			}
+
+			return result;
+		}
+		bool rbnk::summarize(std::ostream& output)
+		{
+			bool result = 0;
+
+			if (output.good() && address != ULONG_MAX)
+			{
+				output << "RBNK Content Summary - lavaBRSARLib " << version << "\n";
+				output << "\nNote: In the following summarization, all addresses are relative to the start of the described RBNK file.\n";
+				output << "\nStructure Overview:\n";
+				output << "\tTotal Length/End:\t0x" << lava::numToHexStringWithPadding(size(), 0x08) << " / 0x" << lava::numToHexStringWithPadding(size(), 0x08) << "\n";
+				output << "\tData Section Offset:\t0x" << lava::numToHexStringWithPadding(getDATASectionOffset(), 0x08) << "\n";
+				output << "\tData Section Length/End:\t0x" << lava::numToHexStringWithPadding(getDATASectionSize(), 0x08) << " / 0x" << lava::numToHexStringWithPadding(getDATASectionOffset() + getDATASectionSize(), 0x08) << "\n";
+				output << "\tInstrument Count:\t\t0x" << lava::numToHexStringWithPadding(dataSection.instruments.size(), 0x04) << "\n";
+				output << "\tRegion Node Count:\t\t0x" << lava::numToHexStringWithPadding(dataSection.nodes.size(), 0x04) << "\n";
+				output << "\tWave Section Offset:\t0x" << lava::numToHexStringWithPadding(getWAVESectionOffset(), 0x08) << "\n";
+				output << "\tWave Section Length/End:\t0x" << lava::numToHexStringWithPadding(getWAVESectionSize(), 0x08) << " / 0x" << lava::numToHexStringWithPadding(getWAVESectionOffset() + getWAVESectionSize(), 0x08) << "\n";
+				output << "\tWave Entry Count:\t\t0x" << lava::numToHexStringWithPadding(waveSection.entries.size(), 0x04) << "\n";
+
+				output << "\nInstrument Summary:\n";
+				result = 1;
+				std::vector<unsigned long> nodeOffsets = dataSection.calculateNodeOffsetVector();
+				for (std::size_t i = 0; result && i < dataSection.instruments.size(); i++)
+				{
+					output << "\tInstrument 0x" << lava::numToHexStringWithPadding(i, 0x04) << "\n";
+					result &= summarizeRegion(output, dataSection.instruments[i], nodeOffsets, 0);
+				}
+
+				output << "\nWave Summary:\n";
+				unsigned long waveDataBaseAddress = getWAVESectionOffset() + getWAVESectionSize();
+				for (std::size_t i = 0; i < waveSection.entries.size(); i++)
+				{
+					const waveInfo* currWaveEntry = &waveSection.entries[i];
+					output << "\tWave Entry 0x" << lava::numToHexStringWithPadding(i, 0x04) << " (Used by " << dataSection.getWaveReferenceCount(i) << " Region(s))\n";
+					output << "\t\tChannels / Sample Rate:\t" << unsigned long(currWaveEntry->channels) << " / " << currWaveEntry->getSampleRate() << "\n";
+					output << "\t\tWave Contents Offset / Address:\t0x" << lava::numToHexStringWithPadding(currWaveEntry->dataLocation, 0x08) << " / 0x" << lava::numToHexStringWithPadding(waveDataBaseAddress + currWaveEntry->dataLocation, 0x08) << "\n";
+					output << "\t\tWave Contents Length:\t0x" << lava::numToHexStringWithPadding(currWaveEntry->getAudioLengthInBytes(), 0x04) << "\n";
+				}
+				result &= output.good();
+			}
+
+			return result;
+		}
+		bool rbnk::summarize(std::string filepath)
+		{
+			bool result = 0;
+
+			std::ofstream output(filepath, std::ios_base::out);
+			if (output.is_open())
+			{
+				result = summarize(output);
+			}
+
+			return result;
+		}
+
+		bool rbnk::overwriteInstParam(unsigned long nodeIndex, const rbnkInstParam& instParamIn)
+		{
+			bool result = 0;
+
+			if (nodeIndex < dataSection.nodes.size() && dataSection.nodes[nodeIndex].regionType == rbnkRegionTypes::rrt_INST_PARAM)
+			{
+				dataSection.nodes[nodeIndex].instParam = instParamIn;
+				result = 1;
+			}
+
+			return result;
+		}
+		bool rbnk::overwriteWaveRawDataWithDSP(unsigned long waveSectionIndex, const dsp& dspIn)
+		{
+			bool result = waveSection.overwriteWaveRawDataWithDSP(waveSectionIndex, dspIn);
+			signalWAVESectionSizeChange();
+			return result;
+		}
+		bool rbnk::overwriteWaveRawDataWithDSP(unsigned long waveSectionIndex, std::string dspPathIn)
+		{
+			bool result = waveSection.overwriteWaveRawDataWithDSP(waveSectionIndex, dspPathIn);
+			signalWAVESectionSizeChange();
+			return result;
+		}
+		bool rbnk::overwriteWaveRawDataWithDSPs(unsigned long waveSectionIndex, const std::vector<dsp>& dspsIn)
+		{
+			bool result = waveSection.overwriteWaveRawDataWithDSPs(waveSectionIndex, dspsIn);
+			signalWAVESectionSizeChange();
+			return result;
+		}
+		bool rbnk::overwriteWaveRawDataWithWAV(unsigned long waveSectionIndex, const wav& wavIn, unsigned long threadCount, unsigned char encodeModeIn, unsigned long targetSampleRateIn,
+			std::vector<gcADPCMEncodeReport>* reportsOut)
+		{
+			bool result = waveSection.overwriteWaveRawDataWithWAV(waveSectionIndex, wavIn, threadCount, encodeModeIn, targetSampleRateIn, reportsOut);
+			signalWAVESectionSizeChange();
+			return result;
+		}
+		bool rbnk::overwriteWaveRawDataWithWAV(unsigned long waveSectionIndex, std::string wavPathIn, unsigned long threadCount, unsigned char encodeModeIn, unsigned long targetSampleRateIn,
+			std::vector<gcADPCMEncodeReport>* reportsOut)
+		{
+			bool result = waveSection.overwriteWaveRawDataWithWAV(waveSectionIndex, wavPathIn, threadCount, encodeModeIn, targetSampleRateIn, reportsOut);
+			signalWAVESectionSizeChange();
+			return result;
+		}
+		bool rbnk::overwriteWaveRawDataWithWAVs(const std::vector<std::pair<unsigned long, std::string>>& waveIndicesToWAVPathsIn, unsigned long threadCount,
+			unsigned char encodeModeIn, unsigned long targetSampleRateIn, std::vector<char>* succeededOut, std::vector<std::vector<gcADPCMEncodeReport>>* reportsOut)
+		{
+			bool result = waveSection.overwriteWaveRawDataWithWAVs(waveIndicesToWAVPathsIn, threadCount, encodeModeIn, targetSampleRateIn, succeededOut, reportsOut);
+			signalWAVESectionSizeChange();
+			return result;
+		}
+
+		/* RBNK */
+
+		/* RWAR */
+
+		bool rwarEntry::getWaveInfo(waveInfo& infoOut) const
+		{
+			bool result = 0;
+
+			lava::byteArray contentsArr(contents.data(), contents.size());
+			if (contentsArr.populated() && contentsArr.getLong(0x00) == brsarHexTags::bht_RWAV)
+			{
+				unsigned long infoSectionAddress = contentsArr.getLong(0x10);
+				unsigned long dataSectionAddress = contentsArr.getLong(0x18);
+				unsigned long dataSectionLength = contentsArr.getLong(0x1C);
+				if (contentsArr.getLong(infoSectionAddress) == brsarHexTags::bht_INFO && contentsArr.getLong(dataSectionAddress) == brsarHexTags::bht_SUBF_DATA
+					&& (dataSectionAddress + dataSectionLength) <= contents.size())
+				{
+					infoOut = waveInfo();
+					if (infoOut.populate(contentsArr, infoSectionAddress + 0x08))
+					{
+						// Pull the audio in as well, so the channel data functions work on the result.
+						unsigned long dataBodyAddress = dataSectionAddress + 0x08;
+						unsigned long dataBodyLength = dataSectionLength - 0x08;
+						if (infoOut.dataLocation <= dataBodyLength)
+						{
+							unsigned long audioLength = std::min(infoOut.getAudioLengthInBytes(), dataBodyLength - infoOut.dataLocation);
+							result = infoOut.packetContents.populate(contentsArr, dataBodyAddress + infoOut.dataLocation, audioLength, 0x00);
+						}
+					}
+				}
+			}
+
+			return result;
+		}
+
+		unsigned long rwar::getTABLSectionSize() const
+		{
+			return padLengthTo(0x0C + (0x0C * entries.size()), 0x20);
+		}
+		unsigned long rwar::getDATASectionSize() const
+		{
+			unsigned long result = 0x20;
+
+			for (std::size_t i = 0; i < entries.size(); i++)
+			{
+				result += padLengthTo(entries[i].contents.size(), 0x20);
+			}
+
+			return result;
+		}
+		unsigned long rwar::getTABLSectionOffset() const
+		{
+			return 0x20;
+		}
+		unsigned long rwar::getDATASectionOffset() const
+		{
+			return getTABLSectionOffset() + getTABLSectionSize();
+		}
+		unsigned long rwar::size() const
+		{
+			unsigned long result = 0x00;
+
+			result =
+				0x20 // Header Length
+				+ getTABLSectionSize() // TABL Section Size
+				+ getDATASectionSize(); // DATA Section Size
+
+			return result;
+		}
+		std::vector<unsigned long> rwar::calculateEntryOffsetVector() const
+		{
+			std::vector<unsigned long> result{};
+
+			// The DATA header is padded out to 0x20 before the first RWAV.
+			unsigned long currentOffset = 0x20;
+			for (std::size_t i = 0; i < entries.size(); i++)
+			{
+				result.push_back(currentOffset);
+				currentOffset += padLengthTo(entries[i].contents.size(), 0x20);
+			}
+
+			return result;
+		}
+
+		bool rwar::populate(const byteArray& fileBodyIn, unsigned long fileBodyAddressIn)
+		{
+			bool result = 0;
+
+			if (fileBodyIn.getLong(fileBodyAddressIn) == brsarHexTags::bht_SUBF_RWAR)
+			{
+				address = fileBodyAddressIn;
+
+				endianType = fileBodyIn.getShort(fileBodyAddressIn + 0x04);
+				versionNumber = fileBodyIn.getShort(fileBodyAddressIn + 0x06);
+				unsigned long tablSectionAddress = fileBodyAddressIn + fileBodyIn.getLong(fileBodyAddressIn + 0x10);
+				unsigned long dataSectionAddress = fileBodyAddressIn + fileBodyIn.getLong(fileBodyAddressIn + 0x18);
+
+				if (fileBodyIn.getLong(tablSectionAddress) == brsarHexTags::bht_SUBF_TABL && fileBodyIn.getLong(dataSectionAddress) == brsarHexTags::bht_SUBF_DATA)
+				{
+					unsigned long entryCount = fileBodyIn.getLong(tablSectionAddress + 0x08);
+					result = entryCount != ULONG_MAX;
+					entries.clear();
+					for (unsigned long i = 0; result && i < entryCount; i++)
+					{
+						std::size_t cursor = tablSectionAddress + 0x0C + (i * 0x0C);
+						entries.push_back(rwarEntry());
+						rwarEntry* currEntry = &entries.back();
+						currEntry->referenceType = fileBodyIn.getLong(cursor, &cursor);
+						currEntry->address = dataSectionAddress + fileBodyIn.getLong(cursor, &cursor);
+						unsigned long entryLength = fileBodyIn.getLong(cursor, &cursor);
+						result = (currEntry->address + entryLength) <= fileBodyIn.size();
+						if (result)
+						{
+							currEntry->contents = fileBodyIn.getBytes(entryLength, currEntry->address);
+						}
+					}
+				}
+			}
+
+			return result;
+		}
+		bool rwar::populate(std::string filePathIn)
+		{
+			bool result = 0;
+
+			lava::byteArray fileArray(filePathIn);
+			if (fileArray.populated())
+			{
+				result = populate(fileArray, 0x00);
+			}
+
+			return result;
+		}
+
+		bool rwar::exportContents(std::ostream& destinationStream) const
+		{
+			bool result = 0;
+
+			if (destinationStream.good())
+			{
+				// Write Header Data
+				writeRawDataToStream(destinationStream, brsarHexTags::bht_SUBF_RWAR); // Write RWAR Tag
+				writeRawDataToStream(destinationStream, endianType); // Write Big-Endian BOM
+				writeRawDataToStream(destinationStream, versionNumber); // Write Version
+				writeRawDataToStream(destinationStream, size()); // RWAR Length
+				writeRawDataToStream(destinationStream, unsigned short(getTABLSectionOffset())); // Offset to first subsection
+				writeRawDataToStream(destinationStream, unsigned short(0x02)); // Write number of subsections
+				writeRawDataToStream(destinationStream, getTABLSectionOffset()); // TABL Subsection Offset
+				writeRawDataToStream(destinationStream, getTABLSectionSize()); // TABL Subsection Length
+				writeRawDataToStream(destinationStream, getDATASectionOffset()); // DATA Subsection Offset
+				writeRawDataToStream(destinationStream, getDATASectionSize()); // DATA Subsection Length
+
+				// Write TABL Section
+				std::vector<unsigned long> entryOffsets = calculateEntryOffsetVector();
+				writeRawDataToStream(destinationStream, brsarHexTags::bht_SUBF_TABL);
+				writeRawDataToStream(destinationStream, getTABLSectionSize());
+				writeRawDataToStream(destinationStream, unsigned long(entries.size()));
+				for (std::size_t i = 0; i < entries.size(); i++)
+				{
+					writeRawDataToStream(destinationStream, entries[i].referenceType);
+					writeRawDataToStream(destinationStream, entryOffsets[i]);
+					writeRawDataToStream(destinationStream, unsigned long(entries[i].contents.size()));
+				}
+				std::vector<char> padding(getTABLSectionSize() - (0x0C + (0x0C * entries.size())), 0x00);
+				destinationStream.write(padding.data(), padding.size());
+
+				// Write DATA Section
+				writeRawDataToStream(destinationStream, brsarHexTags::bht_SUBF_DATA);
+				writeRawDataToStream(destinationStream, getDATASectionSize());
+				padding.assign(0x18, 0x00);
+				destinationStream.write(padding.data(), padding.size());
+				for (std::size_t i = 0; i < entries.size(); i++)
+				{
+					const std::vector<unsigned char>* currContents = &entries[i].contents;
+					destinationStream.write((const char*)currContents->data(), currContents->size());
+					padding.assign(padLengthTo(currContents->size(), 0x20) - currContents->size(), 0x00);
+					destinationStream.write(padding.data(), padding.size());
+				}
+
+				result = destinationStream.good();
+			}
+
+			return result;
+		}
+		bool rwar::exportContents(std::string filePathIn) const
+		{
+			bool result = 0;
+
+			std::ofstream output(filePathIn, std::ios_base::out | std::ios_base::binary);
+			if (output.is_open())
+			{
+				result = exportContents(output);
+			}
+
+			return result;
+		}
+		std::vector<unsigned char> rwar::contentsToVec() const
+		{
+			std::vector<unsigned char> result;
+
+			std::stringstream tempStream(std::ios_base::in | std::ios_base::out | std::ios_base::binary);
+			if (exportContents(tempStream))
+			{
+				result = streamContentsToVec(tempStream);
+			}
+
+			return result;
+		}
+
+		bool rwar::summarize(std::ostream& output) const
+		{
+			bool result = 0;
+
+			if (output.good() && address != ULONG_MAX)
+			{
+				output << "RWAR Content Summary - lavaBRSARLib " << version << "\n";
+				output << "\nStructure Overview:\n";
+				output << "\tTotal Length/End:\t0x" << lava::numToHexStringWithPadding(size(), 0x08) << " / 0x" << lava::numToHexStringWithPadding(size(), 0x08) << "\n";
+				output << "\tTable Section Offset:\t0x" << lava::numToHexStringWithPadding(getTABLSectionOffset(), 0x08) << "\n";
+				output << "\tTable Section Length/End:\t0x" << lava::numToHexStringWithPadding(getTABLSectionSize(), 0x08) << " / 0x" << lava::numToHexStringWithPadding(getTABLSectionOffset() + getTABLSectionSize(), 0x08) << "\n";
+				output << "\tData Section Offset:\t0x" << lava::numToHexStringWithPadding(getDATASectionOffset(), 0x08) << "\n";
+				output << "\tData Section Length/End:\t0x" << lava::numToHexStringWithPadding(getDATASectionSize(), 0x08) << " / 0x" << lava::numToHexStringWithPadding(getDATASectionOffset() + getDATASectionSize(), 0x08) << "\n";
+				output << "\tEntry Count:\t\t0x" << lava::numToHexStringWithPadding(entries.size(), 0x04) << "\n";
+
+				output << "\nEntries:\n";
+				std::vector<unsigned long> entryOffsets = calculateEntryOffsetVector();
+				for (std::size_t i = 0; i < entries.size(); i++)
+				{
+					output << "\tEntry 0x" << lava::numToHexStringWithPadding(i, 0x04) << " (Offset: 0x" << lava::numToHexStringWithPadding(entryOffsets[i], 0x08)
+						<< ", Length: 0x" << lava::numToHexStringWithPadding(entries[i].contents.size(), 0x08) << ")\n";
+					waveInfo entryInfo;
+					if (entries[i].getWaveInfo(entryInfo))
+					{
+						output << "\t\tEncoding: " << unsigned long(entryInfo.encoding) << ", Channels: " << unsigned long(entryInfo.channels)
+							<< ", Sample Rate: " << entryInfo.getSampleRate() << ", Looped: " << unsigned long(entryInfo.looped)
+							<< ", Nibbles: 0x" << lava::numToHexStringWithPadding(entryInfo.nibbles, 0x08) << "\n";
+					}
+					else
+					{
+						output << "\t\tUnable to parse RWAV info!\n";
+					}
+				}
+
+				result = output.good();
+			}
+
+			return result;
+		}
+		bool rwar::summarize(std::string filepath) const
+		{
+			bool result = 0;
+
+			std::ofstream output(filepath, std::ios_base::out);
+			if (output.is_open())
+			{
+				result = summarize(output);
+			}
+
+			return result;
+		}
+
+		/* RWAR */
+
+		/* RSEQ */
+
+		rseqEventIterator::rseqEventIterator(const unsigned char* dataIn, std::size_t lengthIn, std::size_t startOffsetIn) :
+			dataStart(dataIn), dataLength(lengthIn), cursor(startOffsetIn) {}
+		bool rseqEventIterator::atEnd() const
+		{
+			return dataStart == nullptr || cursor >= dataLength;
+		}
+		std::size_t rseqEventIterator::getOffset() const
+		{
+			return cursor;
+		}
+		void rseqEventIterator::seek(std::size_t offsetIn)
+		{
+			cursor = offsetIn;
+		}
+		bool rseqEventIterator::readByte(unsigned char& valueOut)
+		{
+			bool result = 0;
+
+			if (!atEnd())
+			{
+				valueOut = dataStart[cursor++];
+				result = 1;
+			}
+
+			return result;
+		}
+		bool rseqEventIterator::readArg(unsigned char argTypeIn, signed long& valueOut, signed long& randomMaxOut)
+		{
+			bool result = 0;
+
+			unsigned char currByte = 0x00;
+			switch (argTypeIn)
+			{
+				case rseqArgTypes::rat_U8:
+				case rseqArgTypes::rat_VARIABLE:
+				{
+					result = readByte(currByte);
+					valueOut = currByte;
+					break;
+				}
+				case rseqArgTypes::rat_S16:
+				{
+					unsigned char lowByte = 0x00;
+					result = readByte(currByte) && readByte(lowByte);
+					valueOut = signed short((unsigned short(currByte) << 0x08) | lowByte);
+					break;
+				}
+				case rseqArgTypes::rat_VMIDI:
+				{
+					// MIDI-style variable length value: 7 bits per byte, high bit set on all but the last.
+					valueOut = 0x00;
+					result = 1;
+					for (unsigned long i = 0; result && i < 4; i++)
+					{
+						result = readByte(currByte);
+						valueOut = (valueOut << 0x07) | (currByte & 0x7F);
+						if (!(currByte & 0x80))
+						{
+							break;
+						}
+					}
+					break;
+				}
+				case rseqArgTypes::rat_RANDOM:
+				{
+					result = readArg(rseqArgTypes::rat_S16, valueOut, randomMaxOut) && readArg(rseqArgTypes::rat_S16, randomMaxOut, randomMaxOut);
+					break;
+				}
+				default:
+				{
+					break;
+				}
+			}
+
+			return result;
+		}
+		bool rseqEventIterator::next(rseqEvent& eventOut)
+		{
+			bool result = 0;
+
+			eventOut = rseqEvent();
+			if (!atEnd())
+			{
+				eventOut.offset = cursor;
+
+				unsigned char currByte = 0x00;
+				unsigned char overrideArgType = UCHAR_MAX;
+				unsigned char timeArgType = UCHAR_MAX;
+				result = readByte(currByte);
+				while (result && currByte >= rseqOpcodes::ro_PREFIX_RANDOM && currByte <= rseqOpcodes::ro_PREFIX_TIME_VARIABLE)
+				{
+					switch (currByte)
+					{
+						case rseqOpcodes::ro_PREFIX_RANDOM: { eventOut.prefixes |= rseqPrefixFlags::rpf_RANDOM; overrideArgType = rseqArgTypes::rat_RANDOM; break; }
+						case rseqOpcodes::ro_PREFIX_VARIABLE: { eventOut.prefixes |= rseqPrefixFlags::rpf_VARIABLE; overrideArgType = rseqArgTypes::rat_VARIABLE; break; }
+						case rseqOpcodes::ro_PREFIX_IF: { eventOut.prefixes |= rseqPrefixFlags::rpf_IF; break; }
+						case rseqOpcodes::ro_PREFIX_TIME: { eventOut.prefixes |= rseqPrefixFlags::rpf_TIME; timeArgType = rseqArgTypes::rat_S16; break; }
+						case rseqOpcodes::ro_PREFIX_TIME_RANDOM: { eventOut.prefixes |= rseqPrefixFlags::rpf_TIME_RANDOM; timeArgType = rseqArgTypes::rat_RANDOM; break; }
+						case rseqOpcodes::ro_PREFIX_TIME_VARIABLE: { eventOut.prefixes |= rseqPrefixFlags::rpf_TIME_VARIABLE; timeArgType = rseqArgTypes::rat_VARIABLE; break; }
+						default: { break; }
+					}
+					result = readByte(currByte);
+				}
+				eventOut.opcode = currByte;
+
+				auto lastArgType = [overrideArgType](unsigned char defaultTypeIn)
+				{
+					return (overrideArgType != UCHAR_MAX) ? overrideArgType : defaultTypeIn;
+				};
+				unsigned char tempByte = 0x00;
+				signed long tempValue = 0x00;
+				bool takesTimeArg = 0;
+				if (!result)
+				{
+					// Cut off mid-prefix, nothing left to decode.
+				}
+				else if (!(currByte & 0x80))
+				{
+					eventOut.type = rseqEventTypes::ret_NOTE;
+					eventOut.args[0] = currByte;
+					result = readByte(tempByte);
+					eventOut.args[1] = tempByte;
+					result = result && readArg(lastArgType(rseqArgTypes::rat_VMIDI), eventOut.args[2], eventOut.randomMax);
+					eventOut.argCount = 3;
+				}
+				else
+				{
+					switch (currByte & 0xF0)
+					{
+						case 0x80:
+						{
+							switch (currByte)
+							{
+								case rseqOpcodes::ro_WAIT:
+								case rseqOpcodes::ro_PROGRAM:
+								{
+									eventOut.type = (currByte == rseqOpcodes::ro_WAIT) ? rseqEventTypes::ret_WAIT : rseqEventTypes::ret_PROGRAM;
+									result = readArg(lastArgType(rseqArgTypes::rat_VMIDI), eventOut.args[0], eventOut.randomMax);
+									eventOut.argCount = 1;
+									break;
+								}
+								case rseqOpcodes::ro_OPEN_TRACK:
+								case rseqOpcodes::ro_JUMP:
+								case rseqOpcodes::ro_CALL:
+								{
+									eventOut.type = (currByte == rseqOpcodes::ro_OPEN_TRACK) ? rseqEventTypes::ret_OPEN_TRACK :
+										(currByte == rseqOpcodes::ro_JUMP) ? rseqEventTypes::ret_JUMP : rseqEventTypes::ret_CALL;
+									if (currByte == rseqOpcodes::ro_OPEN_TRACK)
+									{
+										result = readByte(tempByte);
+										eventOut.args[eventOut.argCount++] = tempByte;
+									}
+									// Targets are 24-bit offsets into the sequence data.
+									signed long target = 0x00;
+									for (unsigned long i = 0; result && i < 3; i++)
+									{
+										result = readByte(tempByte);
+										target = (target << 0x08) | tempByte;
+									}
+									eventOut.args[eventOut.argCount++] = target;
+									break;
+								}
+								default:
+								{
+									break;
+								}
+							}
+							break;
+						}
+						case 0xB0:
+						case 0xC0:
+						case 0xD0:
+						{
+							eventOut.type = rseqEventTypes::ret_PARAM_U8;
+							result = readArg(lastArgType(rseqArgTypes::rat_U8), eventOut.args[0], eventOut.randomMax);
+							eventOut.argCount = 1;
+							takesTimeArg = 1;
+							break;
+						}
+						case 0xE0:
+						{
+							eventOut.type = rseqEventTypes::ret_PARAM_S16;
+							result = readArg(lastArgType(rseqArgTypes::rat_S16), eventOut.args[0], eventOut.randomMax);
+							eventOut.argCount = 1;
+							takesTimeArg = 1;
+							break;
+						}
+						case 0xF0:
+						{
+							switch (currByte)
+							{
+								case rseqOpcodes::ro_ALLOC_TRACK:
+								{
+									eventOut.type = rseqEventTypes::ret_ALLOC_TRACK;
+									result = readArg(rseqArgTypes::rat_S16, tempValue, eventOut.randomMax);
+									eventOut.args[0] = tempValue & 0xFFFF;
+									eventOut.argCount = 1;
+									break;
+								}
+								case rseqOpcodes::ro_EXTENDED:
+								{
+									result = readByte(eventOut.extendedOpcode);
+									switch (eventOut.extendedOpcode & 0xF0)
+									{
+										case 0x80:
+										case 0x90:
+										{
+											eventOut.type = ((eventOut.extendedOpcode & 0xF0) == 0x80) ? rseqEventTypes::ret_VARIABLE_OP : rseqEventTypes::ret_COMPARE_OP;
+											result = result && readByte(tempByte);
+											eventOut.args[0] = tempByte;
+											result = result && readArg(lastArgType(rseqArgTypes::rat_S16), eventOut.args[1], eventOut.randomMax);
+											eventOut.argCount = 2;
+											break;
+										}
+										case 0xE0:
+										{
+											eventOut.type = rseqEventTypes::ret_USER_PROC;
+											result = result && readArg(lastArgType(rseqArgTypes::rat_S16), eventOut.args[0], eventOut.randomMax);
+											eventOut.argCount = 1;
+											break;
+										}
+										default:
+										{
+											break;
+										}
+									}
+									break;
+								}
+								case rseqOpcodes::ro_LOOP_END: { eventOut.type = rseqEventTypes::ret_LOOP_END; break; }
+								case rseqOpcodes::ro_RETURN: { eventOut.type = rseqEventTypes::ret_RETURN; break; }
+								case rseqOpcodes::ro_FINISH: { eventOut.type = rseqEventTypes::ret_FINISH; break; }
+								default:
+								{
+									break;
+								}
+							}
+							break;
+						}
+						default:
+						{
+							break;
+						}
+					}
+				}
+				if (result && takesTimeArg && timeArgType != UCHAR_MAX)
+				{
+					result = readArg(timeArgType, eventOut.timeArg, eventOut.timeRandomMax);
+				}
+
+				eventOut.length = cursor - eventOut.offset;
+				if (!result)
+				{
+					// The event was cut off by the end of the span; don't let anyone resume partway through it.
+					cursor = dataLength;
+				}
+			}
+
+			return result;
+		}
+
+		unsigned long rseq::getDATASectionSize() const
+		{
+			return padLengthTo(sequenceDataOffset + sequenceData.size(), 0x20);
+		}
+		unsigned long rseq::getLABLSectionSize() const
+		{
+			return labelSection.paddedSize();
+		}
+		unsigned long rseq::getDATASectionOffset() const
+		{
+			return 0x20;
+		}
+		unsigned long rseq::getLABLSectionOffset() const
+		{
+			return getDATASectionOffset() + getDATASectionSize();
+		}
+		unsigned long rseq::size() const
+		{
+			unsigned long result = 0x00;
+
+			result =
+				0x20 // Header Length
+				+ getDATASectionSize() // DATA Section Size
+				+ getLABLSectionSize(); // LABL Section Size
+
+			return result;
+		}
+
+		bool rseq::populate(const byteArray& fileBodyIn, unsigned long fileBodyAddressIn)
+		{
+			bool result = 0;
+
+			if (fileBodyIn.getLong(fileBodyAddressIn) == brsarHexTags::bht_RSEQ)
+			{
+				address = fileBodyAddressIn;
+
+				endianType = fileBodyIn.getShort(fileBodyAddressIn + 0x04);
+				versionNumber = fileBodyIn.getShort(fileBodyAddressIn + 0x06);
+				unsigned long dataSectionAddress = fileBodyAddressIn + fileBodyIn.getLong(fileBodyAddressIn + 0x10);
+				unsigned long dataSectionLength = fileBodyIn.getLong(fileBodyAddressIn + 0x14);
+				unsigned long lablSectionAddress = fileBodyAddressIn + fileBodyIn.getLong(fileBodyAddressIn + 0x18);
+
+				if (fileBodyIn.getLong(dataSectionAddress) == brsarHexTags::bht_SUBF_DATA && (dataSectionAddress + dataSectionLength) <= fileBodyIn.size())
+				{
+					sequenceDataOffset = fileBodyIn.getLong(dataSectionAddress + 0x08);
+					// Sequence data can't begin inside the DATA section's own 0x0C byte header.
+					if (sequenceDataOffset >= 0x0C && sequenceDataOffset <= dataSectionLength)
+					{
+						sequenceData = fileBodyIn.getBytes(dataSectionLength - sequenceDataOffset, dataSectionAddress + sequenceDataOffset);
+						result = labelSection.populate(fileBodyIn, lablSectionAddress);
+						if (result)
+						{
+							trimTrailingPadding();
+						}
+					}
+				}
+			}
+
+			return result;
+		}
+		bool rseq::populate(const brsarFileFileContents& fileContentsIn)
+		{
+			bool result = 0;
+
+			if (fileContentsIn.getFileType() == brsarHexTags::bht_RSEQ)
+			{
+				byteArray headerArr(fileContentsIn.header.data(), fileContentsIn.header.size());
+				result = populate(headerArr, 0x00);
+			}
+
+			return result;
+		}
+		bool rseq::populate(std::string filePathIn)
+		{
+			bool result = 0;
+
+			lava::byteArray fileArray(filePathIn);
+			if (fileArray.populated())
+			{
+				result = populate(fileArray, 0x00);
+			}
+
+			return result;
+		}
+		void rseq::trimTrailingPadding()
+		{
+			// Everything in the DATA section past the last command is zeroed padding, which would otherwise disassemble as a run of
+			// "note 0, 0, 0" commands. Cuts are only made between commands, so a final command's zeroed arguments are left alone,
+			// and only as far back as padding could reach, so that exportFileSection() pads the section back out to its original size.
+			std::size_t originalSectionEnd = sequenceDataOffset + sequenceData.size();
+			std::size_t paddingStart = sequenceData.size();
+			rseqEventIterator events = getEventIterator();
+			rseqEvent currEvent;
+			while (!events.atEnd())
+			{
+				// Events cut off by the end of the data still report where they started and how long they ran.
+				events.next(currEvent);
+				auto eventBegin = sequenceData.begin() + currEvent.offset;
+				if (!std::all_of(eventBegin, eventBegin + currEvent.length, [](unsigned char byteIn) { return byteIn == 0x00; }))
+				{
+					paddingStart = sequenceData.size();
+				}
+				else if (paddingStart == sequenceData.size() && std::size_t(padLengthTo(sequenceDataOffset + currEvent.offset, 0x20)) >= originalSectionEnd)
+				{
+					paddingStart = currEvent.offset;
+				}
+			}
+			// Labels may point at the very end of the data, but nothing past it.
+			for (std::size_t i = 0; i < labelSection.entries.size(); i++)
+			{
+				paddingStart = std::max<std::size_t>(paddingStart, labelSection.entries[i].dataOffset);
+			}
+			if (paddingStart < sequenceData.size())
+			{
+				sequenceData.resize(paddingStart);
+			}
+		}
+		bool rseq::getSequenceDataSpan(const std::vector<unsigned char>& fileBodyIn, const unsigned char*& dataOut, std::size_t& lengthOut)
+		{
+			bool result = 0;
+
+			dataOut = nullptr;
+			lengthOut = 0x00;
+			auto readLong = [&fileBodyIn](std::size_t addressIn)
+			{
+				unsigned long result = ULONG_MAX;
+				if ((addressIn + 0x04) <= fileBodyIn.size())
+				{
+					result = (unsigned long(fileBodyIn[addressIn]) << 0x18) | (unsigned long(fileBodyIn[addressIn + 1]) << 0x10)
+						| (unsigned long(fileBodyIn[addressIn + 2]) << 0x08) | fileBodyIn[addressIn + 3];
+				}
+				return result;
+			};
+			if (readLong(0x00) == brsarHexTags::bht_RSEQ)
+			{
+				std::size_t dataSectionAddress = readLong(0x10);
+				std::size_t dataSectionLength = readLong(0x14);
+				if (readLong(dataSectionAddress) == brsarHexTags::bht_SUBF_DATA && (dataSectionAddress + dataSectionLength) <= fileBodyIn.size())
+				{
+					std::size_t dataOffset = readLong(dataSectionAddress + 0x08);
+					if (dataOffset >= 0x0C && dataOffset <= dataSectionLength)
+					{
+						dataOut = fileBodyIn.data() + dataSectionAddress + dataOffset;
+						lengthOut = dataSectionLength - dataOffset;
+						result = 1;
+					}
+				}
+			}
+
+			return result;
+		}
+
+		bool rseq::exportFileSection(std::ostream& destinationStream) const
+		{
+			bool result = 0;
+
+			if (destinationStream.good())
+			{
+				// Write Header Data
+				writeRawDataToStream(destinationStream, brsarHexTags::bht_RSEQ); // Write RSEQ Tag
+				writeRawDataToStream(destinationStream, endianType); // Write Big-Endian BOM
+				writeRawDataToStream(destinationStream, versionNumber); // Write Version
+				writeRawDataToStream(destinationStream, size()); // RSEQ Length
+				writeRawDataToStream(destinationStream, unsigned short(getDATASectionOffset())); // Offset to first subsection
+				writeRawDataToStream(destinationStream, unsigned short(0x02)); // Write number of subsections
+				writeRawDataToStream(destinationStream, getDATASectionOffset()); // DATA Subsection Offset
+				writeRawDataToStream(destinationStream, getDATASectionSize()); // DATA Subsection Length
+				writeRawDataToStream(destinationStream, getLABLSectionOffset()); // LABL Subsection Offset
+				writeRawDataToStream(destinationStream, getLABLSectionSize()); // LABL Subsection Length
+
+				// Write DATA Section
+				writeRawDataToStream(destinationStream, brsarHexTags::bht_SUBF_DATA);
+				writeRawDataToStream(destinationStream, getDATASectionSize());
+				writeRawDataToStream(destinationStream, sequenceDataOffset);
+				std::vector<char> padding(sequenceDataOffset - 0x0C, 0x00);
+				destinationStream.write(padding.data(), padding.size());
+				destinationStream.write((const char*)sequenceData.data(), sequenceData.size());
+				padding.assign(getDATASectionSize() - (sequenceDataOffset + sequenceData.size()), 0x00);
+				destinationStream.write(padding.data(), padding.size());
+
+				// Write LABL Section
+				result = labelSection.exportContents(destinationStream);
+			}
+
+			return result;
+		}
+		std::vector<unsigned char> rseq::fileSectionToVec() const
+		{
+			std::vector<unsigned char> result;
+
+			std::stringstream tempStream(std::ios_base::in | std::ios_base::out | std::ios_base::binary);
+			if (exportFileSection(tempStream))
+			{
+				result = streamContentsToVec(tempStream);
+			}
+
+			return result;
+		}
+
+		rseqEventIterator rseq::getEventIterator(unsigned long startOffsetIn) const
+		{
+			return rseqEventIterator(sequenceData.data(), sequenceData.size(), startOffsetIn);
+		}
+		unsigned long rseq::getLabelOffset(const std::string& labelNameIn) const
+		{
+			unsigned long result = ULONG_MAX;
+
+			unsigned long labelIndex = labelSection.findLabelIndex(labelNameIn);
+			if (labelIndex != ULONG_MAX)
+			{
+				result = labelSection.entries[labelIndex].dataOffset;
+			}
+
+			return result;
+		}
+		bool rseq::getProgramsUsed(rseqEventIterator eventsIn, std::vector<unsigned long>& programsOut)
+		{
+			bool result = 1;
+
+			programsOut.clear();
+			rseqEvent currEvent;
+			while (result && !eventsIn.atEnd())
+			{
+				result = eventsIn.next(currEvent);
+				if (result && currEvent.type == rseqEventTypes::ret_PROGRAM
+					&& !(currEvent.prefixes & (rseqPrefixFlags::rpf_RANDOM | rseqPrefixFlags::rpf_VARIABLE)))
+				{
+					programsOut.push_back(currEvent.args[0]);
+				}
+			}
+			std::sort(programsOut.begin(), programsOut.end());
+			programsOut.erase(std::unique(programsOut.begin(), programsOut.end()), programsOut.end());
+
+			return result;
+		}
+		bool rseq::summarize(std::ostream& output) const
+		{
+			bool result = 0;
+
+			if (output.good() && address != ULONG_MAX)
+			{
+				output << "RSEQ Content Summary - lavaBRSARLib " << version << "\n";
+				output << "\nNote: In the following summarization, all label offsets are relative to the start of the sequence data.\n";
+				output << "\nStructure Overview:\n";
+				output << "\tTotal Length/End:\t0x" << lava::numToHexStringWithPadding(size(), 0x08) << " / 0x" << lava::numToHexStringWithPadding(size(), 0x08) << "\n";
+				output << "\tData Section Offset:\t0x" << lava::numToHexStringWithPadding(getDATASectionOffset(), 0x08) << "\n";
+				output << "\tData Section Length/End:\t0x" << lava::numToHexStringWithPadding(getDATASectionSize(), 0x08) << " / 0x" << lava::numToHexStringWithPadding(getDATASectionOffset() + getDATASectionSize(), 0x08) << "\n";
+				output << "\tLabel Section Offset:\t0x" << lava::numToHexStringWithPadding(getLABLSectionOffset(), 0x08) << "\n";
+				output << "\tLabel Section Length/End:\t0x" << lava::numToHexStringWithPadding(getLABLSectionSize(), 0x08) << " / 0x" << lava::numToHexStringWithPadding(getLABLSectionOffset() + getLABLSectionSize(), 0x08) << "\n";
+				output << "\tLabel Count:\t\t0x" << lava::numToHexStringWithPadding(labelSection.entries.size(), 0x04) << "\n";
+
+				output << "\nLabels:\n";
+				for (std::size_t i = 0; i < labelSection.entries.size(); i++)
+				{
+					output << "\t0x" << lava::numToHexStringWithPadding(labelSection.entries[i].dataOffset, 0x06) << ": " << labelSection.entries[i].name << "\n";
+				}
+
+				std::array<unsigned long, rseqEventTypes::ret_UNKNOWN + 1> eventTypeCounts{};
+				rseqEventIterator events = getEventIterator();
+				rseqEvent currEvent;
+				while (!events.atEnd())
+				{
+					if (events.next(currEvent))
+					{
+						eventTypeCounts[currEvent.type]++;
+					}
+				}
+				const std::array<const char*, rseqEventTypes::ret_UNKNOWN + 1> eventTypeNames =
+				{
+					"Notes", "Waits", "Program Changes", "Track Opens", "Jumps", "Calls", "U8 Param Changes", "S16 Param Changes",
+					"Track Allocations", "Variable Ops", "Compare Ops", "User Procs", "Loop Ends", "Returns", "Finishes", "Unknown Commands",
+				};
+				output << "\nEvent Counts:\n";
+				for (std::size_t i = 0; i < eventTypeCounts.size(); i++)
+				{
+					if (eventTypeCounts[i] > 0)
+					{
+						output << "\t" << eventTypeNames[i] << ":\t" << eventTypeCounts[i] << "\n";
+					}
+				}
+
+				std::vector<unsigned long> programsUsed{};
+				getProgramsUsed(getEventIterator(), programsUsed);
+				output << "\nPrograms Used:";
+				for (std::size_t i = 0; i < programsUsed.size(); i++)
+				{
+					output << " " << programsUsed[i];
+				}
+				output << "\n";
+
+				result = output.good();
+			}
+
+			return result;
+		}
+		bool rseq::summarize(std::string filepath) const
+		{
+			bool result = 0;
+
+			std::ofstream output(filepath, std::ios_base::out);
+			if (output.is_open())
+			{
+				result = summarize(output);
+			}
+
+			return result;
+		}
+
+		const std::array<const char*, 0x80> rseqCommandMnemonics = []()
+		{
+			std::array<const char*, 0x80> result{};
+
+			result[rseqOpcodes::ro_WAIT - 0x80] = "wait";
+			result[rseqOpcodes::ro_PROGRAM - 0x80] = "prg";
+			result[rseqOpcodes::ro_OPEN_TRACK - 0x80] = "opentrack";
+			result[rseqOpcodes::ro_JUMP - 0x80] = "jump";
+			result[rseqOpcodes::ro_CALL - 0x80] = "call";
+			const std::array<const char*, 0x30> paramMnemonics =
+			{
+				"timebase", "env_hold", "monophonic", "velocity_range", nullptr, nullptr, nullptr, nullptr,
+				nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr,
+				"pan", "volume", "main_volume", "transpose", "pitch_bend", "bend_range", "priority", "notewait",
+				"tie", "porta", "mod_depth", "mod_speed", "mod_type", "mod_range", "porta_sw", "porta_time",
+				"attack", "decay", "sustain", "release", "loop_start", "volume2", "printvar", "span",
+				"lpf_cutoff", "fxsend_a", "fxsend_b", "mainsend", "init_pan", "mute", "fxsend_c", "damper",
+			};
+			std::copy(paramMnemonics.begin(), paramMnemonics.end(), result.begin() + 0x30);
+			result[0xE0 - 0x80] = "mod_delay";
+			result[0xE1 - 0x80] = "tempo";
+			result[0xE3 - 0x80] = "sweep_pitch";
+			result[rseqOpcodes::ro_LOOP_END - 0x80] = "loop_end";
+			result[rseqOpcodes::ro_RETURN - 0x80] = "ret";
+			result[rseqOpcodes::ro_ALLOC_TRACK - 0x80] = "alloctrack";
+			result[rseqOpcodes::ro_FINISH - 0x80] = "fin";
+
+			return result;
+		}();
+		const std::array<const char*, 0x80> rseqExtendedMnemonics = []()
+		{
+			std::array<const char*, 0x80> result{};
+
+			const std::array<const char*, 0x0C> variableOpMnemonics =
+			{
+				"setvar", "addvar", "subvar", "mulvar", "divvar", "shiftvar", "randvar", "andvar", "orvar", "xorvar", "notvar", "modvar",
+			};
+			std::copy(variableOpMnemonics.begin(), variableOpMnemonics.end(), result.begin());
+			const std::array<const char*, 0x06> compareOpMnemonics =
+			{
+				"cmp_eq", "cmp_ge", "cmp_gt", "cmp_le", "cmp_lt", "cmp_ne",
+			};
+			std::copy(compareOpMnemonics.begin(), compareOpMnemonics.end(), result.begin() + 0x10);
+			result[0xE0 - 0x80] = "userproc";
+
+			return result;
+		}();
+
+		std::string rseq::getMnemonic(const rseqEvent& eventIn)
+		{
+			std::string result = "";
+
+			switch (eventIn.type)
+			{
+				case rseqEventTypes::ret_NOTE:
+				{
+					result = "note";
+					break;
+				}
+				case rseqEventTypes::ret_VARIABLE_OP:
+				case rseqEventTypes::ret_COMPARE_OP:
+				case rseqEventTypes::ret_USER_PROC:
+				{
+					const char* tableEntry = rseqExtendedMnemonics[eventIn.extendedOpcode & 0x7F];
+					result = (tableEntry != nullptr) ? tableEntry : "ext_" + lava::numToHexStringWithPadding(eventIn.extendedOpcode, 0x02);
+					break;
+				}
+				default:
+				{
+					const char* tableEntry = rseqCommandMnemonics[eventIn.opcode & 0x7F];
+					result = (tableEntry != nullptr) ? tableEntry : "cmd_" + lava::numToHexStringWithPadding(eventIn.opcode, 0x02);
+					break;
+				}
+			}
+
+			return result;
+		}
+		bool rseq::parseMnemonic(const std::string& mnemonicIn, rseqEvent& eventOut)
+		{
+			bool result = 0;
+
+			unsigned long opcode = ULONG_MAX;
+			unsigned long extendedOpcode = ULONG_MAX;
+			if (mnemonicIn == "note")
+			{
+				eventOut.type = rseqEventTypes::ret_NOTE;
+				result = 1;
+			}
+			else if (mnemonicIn.size() == 6 && (mnemonicIn.find("cmd_") == 0 || mnemonicIn.find("ext_") == 0))
+			{
+				unsigned long parsedValue = std::strtoul(mnemonicIn.c_str() + 4, nullptr, 16);
+				((mnemonicIn[0] == 'c') ? opcode : extendedOpcode) = parsedValue;
+			}
+			else
+			{
+				for (std::size_t i = 0; opcode == ULONG_MAX && extendedOpcode == ULONG_MAX && i < 0x80; i++)
+				{
+					if (rseqCommandMnemonics[i] != nullptr && mnemonicIn == rseqCommandMnemonics[i])
+					{
+						opcode = 0x80 + i;
+					}
+					else if (rseqExtendedMnemonics[i] != nullptr && mnemonicIn == rseqExtendedMnemonics[i])
+					{
+						extendedOpcode = 0x80 + i;
+					}
+				}
+			}
+
+			if (extendedOpcode != ULONG_MAX)
+			{
+				opcode = rseqOpcodes::ro_EXTENDED;
+				eventOut.extendedOpcode = extendedOpcode;
+				switch (extendedOpcode & 0xF0)
+				{
+					case 0x80: { eventOut.type = rseqEventTypes::ret_VARIABLE_OP; break; }
+					case 0x90: { eventOut.type = rseqEventTypes::ret_COMPARE_OP; break; }
+					case 0xE0: { eventOut.type = rseqEventTypes::ret_USER_PROC; break; }
+					default: { break; }
+				}
+			}
+			else if (opcode >= 0x80 && opcode <= 0xFF)
+			{
+				switch (opcode)
+				{
+					case rseqOpcodes::ro_WAIT: { eventOut.type = rseqEventTypes::ret_WAIT; break; }
+					case rseqOpcodes::ro_PROGRAM: { eventOut.type = rseqEventTypes::ret_PROGRAM; break; }
+					case rseqOpcodes::ro_OPEN_TRACK: { eventOut.type = rseqEventTypes::ret_OPEN_TRACK; break; }
+					case rseqOpcodes::ro_JUMP: { eventOut.type = rseqEventTypes::ret_JUMP; break; }
+					case rseqOpcodes::ro_CALL: { eventOut.type = rseqEventTypes::ret_CALL; break; }
+					case rseqOpcodes::ro_ALLOC_TRACK: { eventOut.type = rseqEventTypes::ret_ALLOC_TRACK; break; }
+					case rseqOpcodes::ro_LOOP_END: { eventOut.type = rseqEventTypes::ret_LOOP_END; break; }
+					case rseqOpcodes::ro_RETURN: { eventOut.type = rseqEventTypes::ret_RETURN; break; }
+					case rseqOpcodes::ro_FINISH: { eventOut.type = rseqEventTypes::ret_FINISH; break; }
+					default:
+					{
+						if (opcode >= 0xB0 && opcode < 0xE0)
+						{
+							eventOut.type = rseqEventTypes::ret_PARAM_U8;
+						}
+						else if (opcode >= 0xE0 && opcode < 0xF0)
+						{
+							eventOut.type = rseqEventTypes::ret_PARAM_S16;
+						}
+						break;
+					}
+				}
+			}
+			if (!result && eventOut.type != rseqEventTypes::ret_UNKNOWN)
+			{
+				eventOut.opcode = opcode;
+				result = 1;
+			}
+
+			return result;
+		}
+		bool rseq::takesOverrideArg(unsigned char eventTypeIn)
+		{
+			bool result = 0;
+
+			switch (eventTypeIn)
+			{
+				case rseqEventTypes::ret_NOTE:
+				case rseqEventTypes::ret_WAIT:
+				case rseqEventTypes::ret_PROGRAM:
+				case rseqEventTypes::ret_PARAM_U8:
+				case rseqEventTypes::ret_PARAM_S16:
+				case rseqEventTypes::ret_VARIABLE_OP:
+				case rseqEventTypes::ret_COMPARE_OP:
+				case rseqEventTypes::ret_USER_PROC:
+				{
+					result = 1;
+					break;
+				}
+				default:
+				{
+					break;
+				}
+			}
+
+			return result;
+		}
+		unsigned char rseq::getDefaultLastArgType(unsigned char eventTypeIn)
+		{
+			unsigned char result = rseqArgTypes::rat_S16;
+
+			switch (eventTypeIn)
+			{
+				case rseqEventTypes::ret_NOTE:
+				case rseqEventTypes::ret_WAIT:
+				case rseqEventTypes::ret_PROGRAM:
+				{
+					result = rseqArgTypes::rat_VMIDI;
+					break;
+				}
+				case rseqEventTypes::ret_PARAM_U8:
+				{
+					result = rseqArgTypes::rat_U8;
+					break;
+				}
+				default:
+				{
+					break;
+				}
+			}
+
+			return result;
+		}
+		bool rseq::encodeEvent(const rseqEvent& eventIn, std::vector<unsigned char>& destinationVec)
+		{
+			bool result = 0;
+
+			auto pushArg = [&destinationVec](unsigned char argTypeIn, signed long valueIn, signed long randomMaxIn)
+			{
+				switch (argTypeIn)
+				{
+					case rseqArgTypes::rat_U8:
+					case rseqArgTypes::rat_VARIABLE:
+					{
+						destinationVec.push_back(valueIn & 0xFF);
+						break;
+					}
+					case rseqArgTypes::rat_RANDOM:
+					{
+						destinationVec.push_back((valueIn >> 0x08) & 0xFF);
+						destinationVec.push_back(valueIn & 0xFF);
+						valueIn = randomMaxIn;
+						[[fallthrough]];
+					}
+					case rseqArgTypes::rat_S16:
+					{
+						destinationVec.push_back((valueIn >> 0x08) & 0xFF);
+						destinationVec.push_back(valueIn & 0xFF);
+						break;
+					}
+					case rseqArgTypes::rat_VMIDI:
+					{
+						std::array<unsigned char, 4> groups{};
+						unsigned long remainingValue = valueIn & 0x0FFFFFFF;
+						std::size_t groupCount = 0;
+						do
+						{
+							groups[groupCount++] = remainingValue & 0x7F;
+							remainingValue >>= 0x07;
+						} while (remainingValue != 0);
+						for (std::size_t i = groupCount; i > 0; i--)
+						{
+							destinationVec.push_back(groups[i - 1] | ((i > 1) ? 0x80 : 0x00));
+						}
+						break;
+					}
+					default:
+					{
+						break;
+					}
+				}
+			};
+
+			if (eventIn.type != rseqEventTypes::ret_UNKNOWN && (eventIn.type != rseqEventTypes::ret_NOTE || eventIn.opcode < 0x80))
+			{
+				result = 1;
+
+				// Prefixes go out in the order the game's own parser checks for them.
+				if (eventIn.prefixes & rseqPrefixFlags::rpf_IF)
+				{
+					destinationVec.push_back(rseqOpcodes::ro_PREFIX_IF);
+				}
+				unsigned char timeArgType = UCHAR_MAX;
+				if (eventIn.prefixes & rseqPrefixFlags::rpf_TIME)
+				{
+					destinationVec.push_back(rseqOpcodes::ro_PREFIX_TIME);
+					timeArgType = rseqArgTypes::rat_S16;
+				}
+				else if (eventIn.prefixes & rseqPrefixFlags::rpf_TIME_RANDOM)
+				{
+					destinationVec.push_back(rseqOpcodes::ro_PREFIX_TIME_RANDOM);
+					timeArgType = rseqArgTypes::rat_RANDOM;
+				}
+				else if (eventIn.prefixes & rseqPrefixFlags::rpf_TIME_VARIABLE)
+				{
+					destinationVec.push_back(rseqOpcodes::ro_PREFIX_TIME_VARIABLE);
+					timeArgType = rseqArgTypes::rat_VARIABLE;
+				}
+				unsigned char lastArgType = getDefaultLastArgType(eventIn.type);
+				if (eventIn.prefixes & rseqPrefixFlags::rpf_RANDOM)
+				{
+					destinationVec.push_back(rseqOpcodes::ro_PREFIX_RANDOM);
+					lastArgType = rseqArgTypes::rat_RANDOM;
+				}
+				else if (eventIn.prefixes & rseqPrefixFlags::rpf_VARIABLE)
+				{
+					destinationVec.push_back(rseqOpcodes::ro_PREFIX_VARIABLE);
+					lastArgType = rseqArgTypes::rat_VARIABLE;
+				}
+				destinationVec.push_back(eventIn.opcode);
+
+				switch (eventIn.type)
+				{
+					case rseqEventTypes::ret_NOTE:
+					{
+						pushArg(rseqArgTypes::rat_U8, eventIn.args[1], 0);
+						pushArg(lastArgType, eventIn.args[2], eventIn.randomMax);
+						break;
+					}
+					case rseqEventTypes::ret_OPEN_TRACK:
+					case rseqEventTypes::ret_JUMP:
+					case rseqEventTypes::ret_CALL:
+					{
+						std::size_t targetIndex = 0;
+						if (eventIn.type == rseqEventTypes::ret_OPEN_TRACK)
+						{
+							pushArg(rseqArgTypes::rat_U8, eventIn.args[0], 0);
+							targetIndex = 1;
+						}
+						destinationVec.push_back((eventIn.args[targetIndex] >> 0x10) & 0xFF);
+						destinationVec.push_back((eventIn.args[targetIndex] >> 0x08) & 0xFF);
+						destinationVec.push_back(eventIn.args[targetIndex] & 0xFF);
+						break;
+					}
+					case rseqEventTypes::ret_ALLOC_TRACK:
+					{
+						pushArg(rseqArgTypes::rat_S16, eventIn.args[0], 0);
+						break;
+					}
+					case rseqEventTypes::ret_VARIABLE_OP:
+					case rseqEventTypes::ret_COMPARE_OP:
+					{
+						destinationVec.push_back(eventIn.extendedOpcode);
+						pushArg(rseqArgTypes::rat_U8, eventIn.args[0], 0);
+						pushArg(lastArgType, eventIn.args[1], eventIn.randomMax);
+						break;
+					}
+					case rseqEventTypes::ret_USER_PROC:
+					{
+						destinationVec.push_back(eventIn.extendedOpcode);
+						pushArg(lastArgType, eventIn.args[0], eventIn.randomMax);
+						break;
+					}
+					case rseqEventTypes::ret_WAIT:
+					case rseqEventTypes::ret_PROGRAM:
+					case rseqEventTypes::ret_PARAM_U8:
+					case rseqEventTypes::ret_PARAM_S16:
+					{
+						pushArg(lastArgType, eventIn.args[0], eventIn.randomMax);
+						if (timeArgType != UCHAR_MAX && eventIn.type != rseqEventTypes::ret_WAIT && eventIn.type != rseqEventTypes::ret_PROGRAM)
+						{
+							pushArg(timeArgType, eventIn.timeArg, eventIn.timeRandomMax);
+						}
+						break;
+					}
+					default:
+					{
+						break;
+					}
+				}
+			}
+
+			return result;
+		}
+
+		bool rseq::disassemble(std::ostream& output) const
+		{
+			bool result = 0;
+
+			if (output.good())
+			{
+				// Every LABL entry and branch target gets a symbol; targets without a LABL name get a generated one.
+				std::map<unsigned long, std::vector<std::string>> symbols{};
+				for (std::size_t i = 0; i < labelSection.entries.size(); i++)
+				{
+					if (labelSection.entries[i].dataOffset <= sequenceData.size())
+					{
+						symbols[labelSection.entries[i].dataOffset].push_back(labelSection.entries[i].name);
+					}
+				}
+				// Walks the events, cutting any which would run over a symbol short so that every symbol lands on an event boundary.
+				auto walkEvents = [this, &symbols](auto callbackIn)
+				{
+					rseqEventIterator events = getEventIterator();
+					rseqEvent currEvent;
+					while (!events.atEnd())
+					{
+						std::size_t eventOffset = events.getOffset();
+						bool decoded = events.next(currEvent);
+						std::size_t eventEnd = (decoded) ? eventOffset + currEvent.length : sequenceData.size();
+						auto nextSymbol = symbols.upper_bound(eventOffset);
+						if (nextSymbol != symbols.end() && nextSymbol->first < eventEnd)
+						{
+							decoded = 0;
+							eventEnd = nextSymbol->first;
+						}
+						events.seek(eventEnd);
+						callbackIn(eventOffset, eventEnd, decoded, currEvent);
+					}
+				};
+				auto getTargetIndex = [](const rseqEvent& eventIn)
+				{
+					std::size_t result = SIZE_MAX;
+					if (eventIn.type == rseqEventTypes::ret_JUMP || eventIn.type == rseqEventTypes::ret_CALL)
+					{
+						result = 0;
+					}
+					else if (eventIn.type == rseqEventTypes::ret_OPEN_TRACK)
+					{
+						result = 1;
+					}
+					return result;
+				};
+				// Adding a symbol can split an event and expose new targets, so keep going until nothing changes.
+				bool symbolsAdded = 1;
+				while (symbolsAdded)
+				{
+					symbolsAdded = 0;
+					walkEvents([&](std::size_t, std::size_t, bool decodedIn, const rseqEvent& eventIn)
+					{
+						std::size_t targetIndex = getTargetIndex(eventIn);
+						if (decodedIn && targetIndex != SIZE_MAX)
+						{
+							unsigned long target = eventIn.args[targetIndex];
+							if (target < sequenceData.size() && symbols.find(target) == symbols.end())
+							{
+								symbols[target].push_back("loc_" + lava::numToHexStringWithPadding(target, 0x06));
+								symbolsAdded = 1;
+							}
+						}
+					});
+				}
+
+				output << "; RSEQ Disassembly - lavaBRSARLib " << version << "\n";
+				output << "; Offsets in comments are relative to the start of the sequence data.\n\n";
+				for (std::size_t i = 0; i < labelSection.entries.size(); i++)
+				{
+					const lablEntry* currEntry = &labelSection.entries[i];
+					output << ".export " << currEntry->name;
+					if (currEntry->dataOffset > sequenceData.size())
+					{
+						output << ", 0x" << lava::numToHexStringWithPadding(currEntry->dataOffset, 0x06);
+					}
+					output << "\n";
+				}
+
+				auto outputSymbols = [&symbols, &output](unsigned long offsetIn)
+				{
+					auto symbolsItr = symbols.find(offsetIn);
+					if (symbolsItr != symbols.end())
+					{
+						output << "\n";
+						for (std::size_t i = 0; i < symbolsItr->second.size(); i++)
+						{
+							output << symbolsItr->second[i] << ":\n";
+						}
+					}
+				};
+				std::vector<unsigned char> encodedEvent{};
+				walkEvents([&](std::size_t eventOffsetIn, std::size_t eventEndIn, bool decodedIn, const rseqEvent& eventIn)
+				{
+					outputSymbols(eventOffsetIn);
+
+					encodedEvent.clear();
+					bool exact = decodedIn && encodeEvent(eventIn, encodedEvent) && encodedEvent.size() == (eventEndIn - eventOffsetIn)
+						&& std::equal(encodedEvent.begin(), encodedEvent.end(), sequenceData.begin() + eventOffsetIn);
+					if (exact)
+					{
+						output << "\t";
+						if (eventIn.prefixes & rseqPrefixFlags::rpf_IF) output << "if ";
+						if (eventIn.prefixes & rseqPrefixFlags::rpf_TIME) output << "time ";
+						else if (eventIn.prefixes & rseqPrefixFlags::rpf_TIME_RANDOM) output << "timernd ";
+						else if (eventIn.prefixes & rseqPrefixFlags::rpf_TIME_VARIABLE) output << "timevar ";
+						if (eventIn.prefixes & rseqPrefixFlags::rpf_RANDOM) output << "rnd ";
+						else if (eventIn.prefixes & rseqPrefixFlags::rpf_VARIABLE) output << "var ";
+						output << getMnemonic(eventIn);
+
+						std::size_t targetIndex = getTargetIndex(eventIn);
+						for (std::size_t i = 0; i < eventIn.argCount; i++)
+						{
+							output << ((i == 0) ? " " : ", ");
+							if (i == targetIndex)
+							{
+								auto symbolsItr = symbols.find(eventIn.args[i]);
+								if (symbolsItr != symbols.end())
+								{
+									output << symbolsItr->second.front();
+								}
+								else
+								{
+									output << "0x" << lava::numToHexStringWithPadding(eventIn.args[i], 0x06);
+								}
+							}
+							else if (eventIn.type == rseqEventTypes::ret_ALLOC_TRACK)
+							{
+								output << "0x" << lava::numToHexStringWithPadding(eventIn.args[i], 0x04);
+							}
+							else
+							{
+								output << eventIn.args[i];
+							}
+						}
+						if (takesOverrideArg(eventIn.type) && (eventIn.prefixes & rseqPrefixFlags::rpf_RANDOM))
+						{
+							output << ", " << eventIn.randomMax;
+						}
+						if (eventIn.type == rseqEventTypes::ret_PARAM_U8 || eventIn.type == rseqEventTypes::ret_PARAM_S16)
+						{
+							if (eventIn.prefixes & (rseqPrefixFlags::rpf_TIME | rseqPrefixFlags::rpf_TIME_RANDOM | rseqPrefixFlags::rpf_TIME_VARIABLE))
+							{
+								output << ", " << eventIn.timeArg;
+							}
+							if (eventIn.prefixes & rseqPrefixFlags::rpf_TIME_RANDOM)
+							{
+								output << ", " << eventIn.timeRandomMax;
+							}
+						}
+						output << "\t; 0x" << lava::numToHexStringWithPadding(eventOffsetIn, 0x06) << "\n";
+					}
+					else
+					{
+						for (std::size_t i = eventOffsetIn; i < eventEndIn; i += 0x10)
+						{
+							output << "\t.byte";
+							for (std::size_t u = i; u < eventEndIn && u < (i + 0x10); u++)
+							{
+								output << ((u == i) ? " " : ", ") << "0x" << lava::numToHexStringWithPadding(sequenceData[u], 0x02);
+							}
+							output << "\t; 0x" << lava::numToHexStringWithPadding(i, 0x06) << "\n";
+						}
+					}
+				});
+				outputSymbols(sequenceData.size());
+
+				result = output.good();
+			}
+
+			return result;
+		}
+		bool rseq::disassemble(std::string filepath) const
+		{
+			bool result = 0;
+
+			std::ofstream output(filepath, std::ios_base::out);
+			if (output.is_open())
+			{
+				result = disassemble(output);
+			}
+
+			return result;
+		}
+		bool rseq::assemble(std::istream& input)
+		{
+			bool result = 0;
+
+			if (input.good())
+			{
+				std::vector<unsigned char> newSequenceData{};
+				std::unordered_map<std::string, unsigned long> symbols{};
+				// Each fixup is the location of a 24-bit branch target, and the symbol it needs to point to.
+				std::vector<std::pair<std::size_t, std::string>> targetFixups{};
+				std::vector<std::pair<std::string, std::string>> exports{};
+
+				auto parseNumber = [](const std::string& tokenIn, signed long& valueOut)
+				{
+					bool result = 0;
+					if (!tokenIn.empty())
+					{
+						char* parseEnd = nullptr;
+						valueOut = std::strtol(tokenIn.c_str(), &parseEnd, 0);
+						result = *parseEnd == '\0';
+					}
+					return result;
+				};
 
-				dataOffset = bodyIn.getLong(addressIn + 0x10);
-				dataLength = bodyIn.getLong(addressIn + 0x14);
-				waveOffset = bodyIn.getLong(addressIn + 0x18);
-				waveLength = bodyIn.getLong(addressIn + 0x1C);
 				result = 1;
+				std::string currentLine = "";
+				std::vector<std::string> tokens{};
+				unsigned long lineNumber = 0;
+				while (result && std::getline(input, currentLine))
+				{
+					lineNumber++;
+
+					tokens.clear();
+					std::size_t lineEnd = std::min(currentLine.find(';'), currentLine.size());
+					std::size_t tokenStart = 0;
+					for (std::size_t i = 0; i <= lineEnd; i++)
+					{
+						if (i == lineEnd || std::isspace((unsigned char)currentLine[i]) || currentLine[i] == ',')
+						{
+							if (i > tokenStart)
+							{
+								tokens.push_back(currentLine.substr(tokenStart, i - tokenStart));
+							}
+							tokenStart = i + 1;
+						}
+					}
+					if (tokens.empty())
+					{
+						continue;
+					}
+
+					if (tokens.size() == 1 && tokens[0].size() > 1 && tokens[0].back() == ':')
+					{
+						result = symbols.emplace(tokens[0].substr(0, tokens[0].size() - 1), newSequenceData.size()).second;
+					}
+					else if (tokens[0] == ".byte")
+					{
+						signed long byteValue = 0x00;
+						for (std::size_t i = 1; result && i < tokens.size(); i++)
+						{
+							result = parseNumber(tokens[i], byteValue) && byteValue >= SCHAR_MIN && byteValue <= UCHAR_MAX;
+							newSequenceData.push_back(byteValue & 0xFF);
+						}
+					}
+					else if (tokens[0] == ".export")
+					{
+						result = tokens.size() == 2 || tokens.size() == 3;
+						if (result)
+						{
+							exports.push_back(std::make_pair(tokens[1], (tokens.size() == 3) ? tokens[2] : tokens[1]));
+						}
+					}
+					else
+					{
+						rseqEvent newEvent;
+						std::size_t tokenIndex = 0;
+						bool prefixFound = 1;
+						while (prefixFound && tokenIndex < tokens.size())
+						{
+							const std::string* currToken = &tokens[tokenIndex];
+							unsigned char prefixFlag =
+								(*currToken == "if") ? rseqPrefixFlags::rpf_IF :
+								(*currToken == "time") ? rseqPrefixFlags::rpf_TIME :
+								(*currToken == "timernd") ? rseqPrefixFlags::rpf_TIME_RANDOM :
+								(*currToken == "timevar") ? rseqPrefixFlags::rpf_TIME_VARIABLE :
+								(*currToken == "rnd") ? rseqPrefixFlags::rpf_RANDOM :
+								(*currToken == "var") ? rseqPrefixFlags::rpf_VARIABLE : 0x00;
+							prefixFound = prefixFlag != 0x00;
+							if (prefixFound)
+							{
+								newEvent.prefixes |= prefixFlag;
+								tokenIndex++;
+							}
+						}
+						result = tokenIndex < tokens.size() && parseMnemonic(tokens[tokenIndex++], newEvent);
+
+						std::size_t targetIndex = SIZE_MAX;
+						switch (newEvent.type)
+						{
+							case rseqEventTypes::ret_NOTE: { newEvent.argCount = 3; break; }
+							case rseqEventTypes::ret_OPEN_TRACK: { newEvent.argCount = 2; targetIndex = 1; break; }
+							case rseqEventTypes::ret_JUMP:
+							case rseqEventTypes::ret_CALL: { newEvent.argCount = 1; targetIndex = 0; break; }
+							case rseqEventTypes::ret_VARIABLE_OP:
+							case rseqEventTypes::ret_COMPARE_OP: { newEvent.argCount = 2; break; }
+							case rseqEventTypes::ret_LOOP_END:
+							case rseqEventTypes::ret_RETURN:
+							case rseqEventTypes::ret_FINISH: { newEvent.argCount = 0; break; }
+							default: { newEvent.argCount = 1; break; }
+						}
+						std::string targetSymbol = "";
+						for (std::size_t i = 0; result && i < newEvent.argCount; i++)
+						{
+							result = tokenIndex < tokens.size();
+							if (result)
+							{
+								const std::string* currToken = &tokens[tokenIndex++];
+								if (!parseNumber(*currToken, newEvent.args[i]))
+								{
+									result = i == targetIndex;
+									targetSymbol = *currToken;
+								}
+							}
+						}
+						if (result && takesOverrideArg(newEvent.type) && (newEvent.prefixes & rseqPrefixFlags::rpf_RANDOM))
+						{
+							result = tokenIndex < tokens.size() && parseNumber(tokens[tokenIndex++], newEvent.randomMax);
+						}
+						if (result && (newEvent.type == rseqEventTypes::ret_PARAM_U8 || newEvent.type == rseqEventTypes::ret_PARAM_S16))
+						{
+							if (newEvent.prefixes & (rseqPrefixFlags::rpf_TIME | rseqPrefixFlags::rpf_TIME_RANDOM | rseqPrefixFlags::rpf_TIME_VARIABLE))
+							{
+								result = tokenIndex < tokens.size() && parseNumber(tokens[tokenIndex++], newEvent.timeArg);
+							}
+							if (result && (newEvent.prefixes & rseqPrefixFlags::rpf_TIME_RANDOM))
+							{
+								result = tokenIndex < tokens.size() && parseNumber(tokens[tokenIndex++], newEvent.timeRandomMax);
+							}
+						}
+						if (result && newEvent.type == rseqEventTypes::ret_NOTE)
+						{
+							newEvent.opcode = newEvent.args[0];
+							result = newEvent.args[0] >= 0x00 && newEvent.args[0] < 0x80;
+						}
+						result = result && tokenIndex == tokens.size() && encodeEvent(newEvent, newSequenceData);
+						if (result && !targetSymbol.empty())
+						{
+							// The target is always the last three bytes of the command.
+							targetFixups.push_back(std::make_pair(newSequenceData.size() - 0x03, targetSymbol));
+						}
+					}
+
+					if (!result)
+					{
+						std::cerr << "[ERROR] Failed to assemble line " << lineNumber << ": \"" << currentLine << "\"\n";
+					}
+				}
+
+				// Backpatch branch targets now that every symbol is known.
+				for (std::size_t i = 0; result && i < targetFixups.size(); i++)
+				{
+					auto symbolsItr = symbols.find(targetFixups[i].second);
+					result = symbolsItr != symbols.end();
+					if (result)
+					{
+						newSequenceData[targetFixups[i].first] = (symbolsItr->second >> 0x10) & 0xFF;
+						newSequenceData[targetFixups[i].first + 1] = (symbolsItr->second >> 0x08) & 0xFF;
+						newSequenceData[targetFixups[i].first + 2] = symbolsItr->second & 0xFF;
+					}
+					else
+					{
+						std::cerr << "[ERROR] Undefined label \"" << targetFixups[i].second << "\"!\n";
+					}
+				}
+				std::vector<lablEntry> newLabelEntries{};
+				for (std::size_t i = 0; result && i < exports.size(); i++)
+				{
+					newLabelEntries.push_back(lablEntry());
+					newLabelEntries.back().name = exports[i].first;
+					auto symbolsItr = symbols.find(exports[i].second);
+					if (symbolsItr != symbols.end())
+					{
+						newLabelEntries.back().dataOffset = symbolsItr->second;
+					}
+					else
+					{
+						signed long exportOffset = 0x00;
+						result = parseNumber(exports[i].second, exportOffset);
+						newLabelEntries.back().dataOffset = exportOffset;
+						if (!result)
+						{
+							std::cerr << "[ERROR] Undefined label \"" << exports[i].second << "\"!\n";
+						}
+					}
+				}
+
+				if (result)
+				{
+					sequenceData = std::move(newSequenceData);
+					labelSection.entries = std::move(newLabelEntries);
+					labelSection.rebuildNameIndex();
+				}
+			}
+
+			return result;
+		}
+		bool rseq::assemble(std::string filepath)
+		{
+			bool result = 0;
+
+			std::ifstream input(filepath, std::ios_base::in);
+			if (input.is_open())
+			{
+				result = assemble(input);
+			}
+
+			return result;
+		}
+
+		bool rseq::renameLabel(const std::string& oldNameIn, const std::string& newNameIn)
+		{
+			return labelSection.renameLabel(oldNameIn, newNameIn);
+		}
+		bool rseq::setLabelOffset(const std::string& labelNameIn, unsigned long offsetIn)
+		{
+			bool result = 0;
+
+			if (!labelNameIn.empty())
+			{
+				unsigned long labelIndex = labelSection.findLabelIndex(labelNameIn);
+				if (labelIndex != ULONG_MAX)
+				{
+					labelSection.entries[labelIndex].dataOffset = offsetIn;
+					result = 1;
+				}
+				else
+				{
+					result = labelSection.addLabel(labelNameIn, offsetIn);
+				}
+			}
+
+			return result;
+		}
+
+		/* RSEQ */
+
+		/* BRSAR File Section */
+
+
+
+		/* BRSAR */
+
+		bool brsarRoundTripResult::matches() const
+		{
+			return parsed && firstHeaderMismatch == ULONG_MAX && firstDataMismatch == ULONG_MAX;
+		}
+		double brsarWaveExportStats::wavesPerSecond() const
+		{
+			return (secondsElapsed > 0.0) ? wavesExported / secondsElapsed : 0.0;
+		}
+
+		unsigned long brsar::size()
+		{
+			return headerLength + getSYMBSectionSize() + getINFOSectionSize() + getVirtualFILESectionSize();
+		}
+		bool brsar::init(std::string filePathIn)
+		{
+			bool result = 0;
+			std::ifstream fileIn;
+			fileIn.open(filePathIn, std::ios_base::in | std::ios_base::binary);
+			if (fileIn.is_open())
+			{
+				std::cout << "Parsing \"" << filePathIn << "\"...\n";
+				byteArray contents(fileIn);
+				fileIn.close();
+				if (contents.populated() && contents.getLong(0x00) == brsarHexTags::bht_RSAR)
+				{
+					std::size_t cursor = 0x04;
+					result = 1;
+					byteOrderMarker = contents.getShort(cursor, &cursor);
+					version = contents.getShort(cursor, &cursor);
+					contents.getLong(cursor, &cursor); // Move Past Length Entry
+					headerLength = contents.getShort(cursor, &cursor);
+					sectionCount = contents.getShort(cursor, &cursor);
+
+					result &= symbSection.populate(*this, contents, contents.getLong(0x10));
+					result &= infoSection.populate(*this, contents, contents.getLong(0x18));
+					// Populate INFO Section's brsarInfoFileHeader structs with their respective raw File Contents
+					if (contents.populated() && contents.getLong(getVirtualFILESectionAddress()) == brsarHexTags::bht_FILE)
+					{
+						brsarInfoGroupHeader* currHeader = nullptr;
+						brsarInfoGroupEntry* currEntry = nullptr;
+						for (std::size_t i = 0; i < infoSection.groupHeaders.size(); i++)
+						{
+							currHeader = infoSection.groupHeaders[i].get();
+							for (std::size_t u = 0; u < currHeader->entries.size(); u++)
+							{
+								currEntry = &currHeader->entries[u];
+								brsarInfoFileHeader* targetFileHeader = infoSection.getFileHeaderPointer(currEntry->fileID);
+								if (targetFileHeader != nullptr)
+								{
+									targetFileHeader->fileContents.header = contents.getBytes(currEntry->headerLength, currHeader->headerAddress + currEntry->headerOffset);
+									targetFileHeader->fileContents.data = contents.getBytes(currEntry->dataLength, currHeader->dataAddress + currEntry->dataOffset);
+								}
+							}
+						}
+					}
+					// Recalculate the referenced addresses and offsets used in the INFO Section's brsarInfoGroupHeader/Entry structs
+					signalVirtualFILESectionSizeChange();
+					infoSection.updateGroupEntryAddressValues();
+				}
+			}
+			return result;
+		}
+		bool brsar::exportVirtualFileSection(std::ostream& destinationStream)
+		{
+			flushRWSDCache();
+			unsigned long fileLengthTotal = 0x20;
+			unsigned long preFileDumpStreamPos = destinationStream.tellp();
+			destinationStream.write(std::vector<char>(0x20, 0x00).data(), 0x20);
+			for (int i = 0; i < infoSection.groupHeaders.size(); i++)
+			{
+				brsarInfoGroupHeader* currGroupHeader = infoSection.groupHeaders[i].get();
+				for (int u = 0; u < currGroupHeader->entries.size(); u++)
+				{
+					brsarInfoGroupEntry* currGroupEntry = &currGroupHeader->entries[u];
+					brsarInfoFileHeader* currFileHeader = infoSection.getFileHeaderPointer(currGroupEntry->fileID);
+					if (currFileHeader != nullptr)
+					{
+						fileLengthTotal += currFileHeader->fileContents.header.size();
+						destinationStream.write((char*)currFileHeader->fileContents.header.data(), currFileHeader->fileContents.header.size());
+					}
+				}
+				for (int u = 0; u < currGroupHeader->entries.size(); u++)
+				{
+					brsarInfoGroupEntry* currGroupEntry = &currGroupHeader->entries[u];
+					brsarInfoFileHeader* currFileHeader = infoSection.getFileHeaderPointer(currGroupEntry->fileID);
+					if (currFileHeader != nullptr)
+					{
+						fileLengthTotal += currFileHeader->fileContents.data.size();
+						destinationStream.write((char*)currFileHeader->fileContents.data.data(), currFileHeader->fileContents.data.size());
+					}
+				}
+			}
+			destinationStream.seekp(preFileDumpStreamPos);
+			writeRawDataToStream(destinationStream, unsigned long(brsarHexTags::bht_FILE));
+			writeRawDataToStream(destinationStream, fileLengthTotal);
+			destinationStream.write(std::vector<char>(0x18, 0x00).data(), 0x18);
+			return 1;
+		}
+		bool brsar::exportContents(std::ostream& destinationStream, bool compactSymbStrings)
+		{
+			// Write any pending RWSD edits back first, they may change the FILE section's size.
+			bool result = flushRWSDCache();
+
+			if (compactSymbStrings)
+			{
+				unsigned long bytesSaved = 0x00;
+				if (compactSymbStringBlock(&bytesSaved))
+				{
+					std::cout << "Compacted SYMB String Block, saved " << bytesSaved << " byte(s) (" << bytesToFileSizeString(bytesSaved) << ").\n";
+				}
+			}
+
+			writeRawDataToStream(destinationStream, brsarHexTags::bht_RSAR);
+			writeRawDataToStream(destinationStream, byteOrderMarker);
+			writeRawDataToStream(destinationStream, version);
+			writeRawDataToStream(destinationStream, size());
+			writeRawDataToStream(destinationStream, headerLength);
+			writeRawDataToStream(destinationStream, sectionCount);
+			writeRawDataToStream(destinationStream, getSYMBSectionAddress());
+			writeRawDataToStream(destinationStream, symbSection.paddedSize());
+			writeRawDataToStream(destinationStream, getINFOSectionAddress());
+			writeRawDataToStream(destinationStream, infoSection.paddedSize());
+			writeRawDataToStream(destinationStream, getVirtualFILESectionAddress());
+			writeRawDataToStream(destinationStream, getVirtualFILESectionSize());
+			if (headerLength > destinationStream.tellp())
+			{
+				std::vector<char> padding(headerLength - destinationStream.tellp(), 0x00);
+				destinationStream.write(padding.data(), padding.size());
 			}
-
+			result &= symbSection.exportContents(destinationStream);
+			result &= infoSection.exportContents(destinationStream);
+			result &= exportVirtualFileSection(destinationStream);
+			
 			return result;
 		}
-		bool rwsdHeader::exportContents(std::ostream& destinationStream)
+		bool brsar::exportContents(std::string outputFilename, bool compactSymbStrings)
 		{
 			bool result = 0;
-			if (destinationStream.good())
-			{
-				destinationStream << "RWSD";
-				lava::writeRawDataToStream(destinationStream, endianType);
-				lava::writeRawDataToStream(destinationStream, version);
-				lava::writeRawDataToStream(destinationStream, headerLength);
-				lava::writeRawDataToStream(destinationStream, entriesOffset);
-				lava::writeRawDataToStream(destinationStream, entriesCount);
-				lava::writeRawDataToStream(destinationStream, dataOffset);
-				lava::writeRawDataToStream(destinationStream, dataLength);
-				lava::writeRawDataToStream(destinationStream, waveOffset);
-				lava::writeRawDataToStream(destinationStream, waveLength);
 
-				result = destinationStream.good();
+			std::ofstream output(outputFilename, std::ios_base::out | std::ios_base::binary);
+			if (output.is_open())
+			{
+				result = exportContents(output, compactSymbStrings);
 			}
-			return result;
-		}
-		constexpr unsigned long rwsdHeader::size()
-		{
-			unsigned long result = 0x0;
-
-			result += sizeof(unsigned long); // Length of RWSD Tag
-			result += sizeof(endianType);
-			result += sizeof(version);
-			result += sizeof(headerLength);
-			result += sizeof(entriesOffset);
-			result += sizeof(entriesCount);
-			result += sizeof(dataOffset);
-			result += sizeof(dataLength);
-			result += sizeof(waveOffset);
-			result += sizeof(waveLength);
 
 			return result;
-		}*/
+		}
 
-		unsigned long rwsd::size()
+		void brsar::signalSYMBSectionSizeChange()
 		{
-			unsigned long result = 0x00;
-
-			result =
-				0x20 // Header Length
-				+ getDATASectionSize() // DATA Section Size
-				+ getWAVESectionSize(); // WAVE Section Size
-
-			return result;
+			symbSectionCachedSize = ULONG_MAX;
 		}
-		void rwsd::signalDATASectionSizeChange()
+		void brsar::signalINFOSectionSizeChange()
 		{
-			dataSectionCachedSize = ULONG_MAX;
+			infoSectionCachedSize = ULONG_MAX;
 		}
-		void rwsd::signalWAVESectionSizeChange()
+		void brsar::signalVirtualFILESectionSizeChange()
 		{
-			waveSectionCachedSize = ULONG_MAX;
+			virtualFileSectionCachedSize = ULONG_MAX;
 		}
-		unsigned long rwsd::getDATASectionSize()
+
+		unsigned long brsar::getSYMBSectionSize()
 		{
-			if (dataSectionCachedSize == ULONG_MAX)
+			if (symbSectionCachedSize == ULONG_MAX)
 			{
-				dataSectionCachedSize = dataSection.paddedSize();
+				symbSectionCachedSize = symbSection.paddedSize();
 			}
-			return dataSectionCachedSize;
+			return symbSectionCachedSize;
 		}
-		unsigned long rwsd::getWAVESectionSize()
+		unsigned long brsar::getINFOSectionSize()
 		{
-			if (waveSectionCachedSize == ULONG_MAX)
+			if (infoSectionCachedSize == ULONG_MAX)
 			{
-				waveSectionCachedSize = waveSection.paddedSize();
+				infoSectionCachedSize = infoSection.paddedSize();
 			}
-			return waveSectionCachedSize;
+			return infoSectionCachedSize;
 		}
-		unsigned long rwsd::getDATASectionOffset()
+		unsigned long brsar::getVirtualFILESectionSize()
 		{
-			return 0x20;
+			if (virtualFileSectionCachedSize == ULONG_MAX)
+			{
+				virtualFileSectionCachedSize = infoSection.virutalFileSectionSize();
+			}
+			return virtualFileSectionCachedSize;
 		}
-		unsigned long rwsd::getWAVESectionOffset()
+
+		unsigned long brsar::getSYMBSectionAddress()
 		{
-			return getDATASectionOffset() + getDATASectionSize();
+			return headerLength;
+		}
+		unsigned long brsar::getINFOSectionAddress()
+		{
+			return headerLength + getSYMBSectionSize();
+		}
+		unsigned long brsar::getVirtualFILESectionAddress()
+		{
+			return headerLength + getSYMBSectionSize() + getINFOSectionSize();
 		}
 
-		bool rwsd::populateWavePacket(const lava::byteArray& bodyIn, unsigned long waveIndex, unsigned long rawDataAddressIn, unsigned long specificDataEndAddressIn)
+		std::string brsar::getSymbString(unsigned long indexIn)
+		{
+			return symbSection.getString(indexIn);
+		}
+		bool brsar::compactSymbStringBlock(unsigned long* bytesSavedOut)
+		{
+			return symbSection.compactStringBlock(bytesSavedOut);
+		}
+		unsigned long brsar::getGroupOffset(unsigned long groupIDIn)
+		{
+			std::size_t result = SIZE_MAX;
+
+			std::size_t i = 0;
+			bool done = 0;
+
+			const brsarInfoGroupHeader* currentGroup = nullptr;
+			while (!done && i < infoSection.groupHeaders.size())
+			{
+				currentGroup = infoSection.groupHeaders[i].get();
+				if (groupIDIn == currentGroup->groupID)
+				{
+					result = currentGroup->getAddress();
+					done = 1;
+				}
+				else
+				{
+					i++;
+				}
+			}
+
+			return result;
+		}
+
+		bool brsar::buildWaveReferrerIndex(unsigned long threadCount)
 		{
 			bool result = 0;
 
-			if (bodyIn.populated())
+			flushRWSDCache();
+			fileIDsToWaveSoundIDs.clear();
+			fileIDsToWaveSoundReferrers.clear();
+			waveReferrerIndexBuilt = 0;
+			if (infoSection.address != ULONG_MAX)
 			{
 				result = 1;
-				waveInfo* currWave = &waveSection.entries[waveIndex];
-				unsigned long length = currWave->getAudioLengthInBytes();
-				unsigned long paddingLength = 0x00;
-				unsigned long currWaveDataEndpoint = rawDataAddressIn + currWave->dataLocation + length;
-				if (currWaveDataEndpoint <= specificDataEndAddressIn)
+
+				std::vector<unsigned long> waveFileIDs{};
+				for (unsigned long i = 0; i < infoSection.soundEntries.size(); i++)
 				{
-					paddingLength = specificDataEndAddressIn - currWaveDataEndpoint;
+					const brsarInfoSoundEntry* currSoundEntry = infoSection.soundEntries[i].get();
+					if (currSoundEntry->soundType == soundInfoTypes::sit_WAVE)
+					{
+						auto emplaceResult = fileIDsToWaveSoundIDs.emplace(currSoundEntry->fileID, std::vector<unsigned long>());
+						if (emplaceResult.second)
+						{
+							waveFileIDs.push_back(currSoundEntry->fileID);
+						}
+						emplaceResult.first->second.push_back(i);
+					}
 				}
-				else
+
+				// Scan each RWSD's DATA entries in parallel, then merge the results in serially.
+				std::vector<std::vector<unsigned long>> dataEntryWaveIndeces(waveFileIDs.size());
+				std::vector<char> scanSucceeded(waveFileIDs.size(), 0);
+				lava::parallelFor(waveFileIDs.size(), [&](std::size_t i)
 				{
-					unsigned long overflowAmount = currWaveDataEndpoint - specificDataEndAddressIn;
-					if (overflowAmount > length)
+					brsarInfoFileHeader* fileHeaderPtr = infoSection.getFileHeaderPointer(waveFileIDs[i]);
+					if (fileHeaderPtr != nullptr)
 					{
-						length = 0;
-						currWave->hollowOut();
-						std::cerr << "Invalid overflow detected in RWSD Wave Data!\n";
+						scanSucceeded[i] = getRWSDDataEntryWaveIndeces(fileHeaderPtr->fileContents, dataEntryWaveIndeces[i]);
 					}
-					else
+				}, threadCount);
+				for (std::size_t i = 0; i < waveFileIDs.size(); i++)
+				{
+					if (scanSucceeded[i])
 					{
-						length -= overflowAmount;
-						currWave->nibbles -= overflowAmount * 2;
+						updateWaveReferrerIndex(waveFileIDs[i], dataEntryWaveIndeces[i]);
 					}
 				}
-				result &= currWave->packetContents.populate(bodyIn, rawDataAddressIn + currWave->dataLocation, length, paddingLength);
+
+				waveReferrerIndexBuilt = 1;
 			}
 
 			return result;
 		}
-		bool rwsd::populateWavePackets(const lava::byteArray& bodyIn, unsigned long waveDataAddressIn, unsigned long waveDataLengthIn)
+		bool brsar::getRWSDDataEntryWaveIndeces(const brsarFileFileContents& contentsIn, std::vector<unsigned long>& waveIndecesOut)
 		{
 			bool result = 0;
 
-			if (bodyIn.populated())
+			waveIndecesOut.clear();
+			if (contentsIn.getFileType() == brsarHexTags::bht_RWSD)
 			{
-				result = 1;
-				for (std::size_t i = 0; i < (waveSection.entries.size() - 1); i++)
+				std::vector<dataInfoView> dataEntryViews{};
+				result = rwsd::getDataEntryViews(contentsIn.header, dataEntryViews);
+				waveIndecesOut.reserve(dataEntryViews.size());
+				for (std::size_t i = 0; i < dataEntryViews.size(); i++)
 				{
-					waveInfo* currWave = &waveSection.entries[i];
-					waveInfo* nextWave = &waveSection.entries[i + 1];
-					result &= populateWavePacket(bodyIn, i, waveDataAddressIn, waveDataAddressIn + nextWave->dataLocation);
+					waveIndecesOut.push_back(dataEntryViews[i].getWaveIndex());
 				}
-				waveInfo* finalWave = &waveSection.entries.back();
-				result &= populateWavePacket(bodyIn, waveSection.entries.size() - 1, waveDataAddressIn, waveDataAddressIn + waveDataLengthIn);
 			}
 
 			return result;
 		}
-		bool rwsd::populate(const byteArray& fileBodyIn, unsigned long fileBodyAddressIn, const byteArray& rawDataIn, unsigned long rawDataAddressIn, unsigned long rawDataLengthIn)
+		bool brsar::updateWaveReferrerIndex(unsigned long fileIDIn, const std::vector<unsigned long>& dataEntryWaveIndecesIn)
 		{
 			bool result = 0;
 
-			if (fileBodyIn.getLong(fileBodyAddressIn) == brsarHexTags::bht_RWSD)
+			auto soundListItr = fileIDsToWaveSoundIDs.find(fileIDIn);
+			if (soundListItr != fileIDsToWaveSoundIDs.end())
 			{
-				address = fileBodyAddressIn;
-
-				endianType = fileBodyIn.getShort(0x04);
-				versionNumber = fileBodyIn.getShort(0x06);
-				unsigned long dataSectionOffset = fileBodyIn.getLong(0x10);
-				unsigned long waveSectionOffset = fileBodyIn.getLong(0x18);
-
-				result = dataSection.populate(fileBodyIn, fileBodyAddressIn + dataSectionOffset);
-				result &= waveSection.populate(fileBodyIn, fileBodyAddressIn + waveSectionOffset);
-				if (result && rawDataAddressIn != ULONG_MAX && (rawDataAddressIn + rawDataLengthIn) <= rawDataIn.size())
+				result = 1;
+				std::unordered_map<unsigned long, std::vector<unsigned long>>* fileWaveReferrers = &fileIDsToWaveSoundReferrers[fileIDIn];
+				fileWaveReferrers->clear();
+				for (std::size_t i = 0; i < soundListItr->second.size(); i++)
 				{
-					result &= populateWavePackets(rawDataIn, rawDataAddressIn, rawDataLengthIn);
+					unsigned long currSoundID = soundListItr->second[i];
+					unsigned long dataIndex = infoSection.soundEntries[currSoundID]->waveSoundInfo.soundIndex;
+					// Entries whose views were invalid come through as ULONG_MAX, and don't reference any wave.
+					if (dataIndex < dataEntryWaveIndecesIn.size() && dataEntryWaveIndecesIn[dataIndex] != ULONG_MAX)
+					{
+						(*fileWaveReferrers)[dataEntryWaveIndecesIn[dataIndex]].push_back(currSoundID);
+					}
 				}
 			}
 
 			return result;
 		}
-		bool rwsd::populate(const brsarFileFileContents& fileContentsIn)
+		bool brsar::updateWaveReferrerIndex(unsigned long fileIDIn, const rwsd& rwsdIn)
+		{
+			std::vector<unsigned long> dataEntryWaveIndeces{};
+			dataEntryWaveIndeces.reserve(rwsdIn.dataSection.entries.size());
+			for (std::size_t i = 0; i < rwsdIn.dataSection.entries.size(); i++)
+			{
+				dataEntryWaveIndeces.push_back(rwsdIn.dataSection.entries[i].ntWaveIndex);
+			}
+			return updateWaveReferrerIndex(fileIDIn, dataEntryWaveIndeces);
+		}
+		bool brsar::refreshWaveReferrerIndex(unsigned long fileIDIn)
 		{
 			bool result = 0;
 
-			if (fileContentsIn.getFileType() == brsarHexTags::bht_RWSD)
+			brsarInfoFileHeader* fileHeaderPtr = infoSection.getFileHeaderPointer(fileIDIn);
+			if (waveReferrerIndexBuilt && fileHeaderPtr != nullptr)
 			{
-				byteArray headerArr(fileContentsIn.header.data(), fileContentsIn.header.size());
-				byteArray dataArr(fileContentsIn.data.data(), fileContentsIn.data.size());
-				result = populate(headerArr, 0x00, dataArr, 0x00, dataArr.size());
+				std::vector<unsigned long> dataEntryWaveIndeces{};
+				if (getRWSDDataEntryWaveIndeces(fileHeaderPtr->fileContents, dataEntryWaveIndeces))
+				{
+					result = updateWaveReferrerIndex(fileIDIn, dataEntryWaveIndeces);
+				}
 			}
 
 			return result;
 		}
-
-		bool rwsd::populate(std::string filePathIn)
+		const std::vector<unsigned long>* brsar::getSoundIDsUsingWave(unsigned long fileIDIn, unsigned long waveIndexIn) const
 		{
-			bool result = 0;
+			const std::vector<unsigned long>* result = nullptr;
 
-			lava::byteArray fileArray(filePathIn);
-			if (fileArray.populated())
+			auto fileItr = fileIDsToWaveSoundReferrers.find(fileIDIn);
+			if (fileItr != fileIDsToWaveSoundReferrers.end())
 			{
-				if (fileArray.getLong(0x00) == brsarHexTags::bht_RWSD)
+				auto waveItr = fileItr->second.find(waveIndexIn);
+				if (waveItr != fileItr->second.end())
 				{
-					unsigned long headerLength = fileArray.getLong(0x08);
-					if (fileArray.size() >= headerLength)
-					{
-						unsigned long dataAddress = headerLength;
-						if (fileArray.size() > (headerLength + 0x08))
-						{
-							if (fileArray.getLong(headerLength) == brsarHexTags::bht_SUBF_LABL)
-							{
-								dataAddress += fileArray.getLong(headerLength + 0x04);
-							}
-						}
-						result = populate(fileArray, 0x00, fileArray, dataAddress, fileArray.size() - dataAddress);
-					}
+					result = &waveItr->second;
 				}
 			}
 
 			return result;
 		}
 
-		bool rwsd::exportFileSection(std::ostream& destinationStream)
+		bool brsar::replaceFileContents(const std::vector<unsigned char>& headerIn, const std::vector<unsigned char>& dataIn, unsigned long fileIDIn)
 		{
 			bool result = 0;
 
-			if (destinationStream.good())
+			brsarInfoFileHeader* fileHeaderPtr = infoSection.getFileHeaderPointer(fileIDIn);
+			if (fileHeaderPtr != nullptr)
 			{
 				result = 1;
+				// Replace File Contents
+				fileHeaderPtr->fileContents.header = headerIn;
+				fileHeaderPtr->fileContents.data = dataIn;
+				// Update the rest of the infoSection to correct the changes to file locations
+				result &= infoSection.updateGroupEntryAddressValues();
+				signalVirtualFILESectionSizeChange();
+			}
 
-				// Write Header Data
-				unsigned long cachedDataSectionSize = dataSection.paddedSize();
-				unsigned long cachedWaveSectionSize = waveSection.paddedSize();
-				writeRawDataToStream(destinationStream, brsarHexTags::bht_RWSD); // Write RWSD Tag
-				writeRawDataToStream(destinationStream, endianType); // Write Big-Endian BOM
-				writeRawDataToStream(destinationStream, versionNumber); // Write Version
-				writeRawDataToStream(destinationStream, size()); // RWSD Length
-				writeRawDataToStream(destinationStream, unsigned short(getDATASectionOffset())); // Offset to first subsection
-				writeRawDataToStream(destinationStream, unsigned short(0x02)); // Write number of subsections
-				writeRawDataToStream(destinationStream, getDATASectionOffset()); // DATA Subsection Offset
-				writeRawDataToStream(destinationStream, getDATASectionSize()); // DATA Subsection Length
-				writeRawDataToStream(destinationStream, getWAVESectionOffset()); // WAVE Subsection Offset
-				writeRawDataToStream(destinationStream, getWAVESectionSize()); // WAVE Subsection Length
+			return result;
+		}
+		bool brsar::removeUnreferencedWaves(unsigned long threadCount, std::ostream* reportOut, unsigned long* totalBytesReclaimedOut)
+		{
+			bool result = 1;
 
-				// Write Subsections
-				result &= dataSection.exportContents(destinationStream);
-				result &= waveSection.exportContents(destinationStream);
+			// Cached parses would go stale, so commit and drop them up front.
+			result &= clearRWSDCache(1);
+
+			std::vector<unsigned long> rwsdFileIDs{};
+			for (unsigned long i = 0; i < infoSection.fileHeaders.size(); i++)
+			{
+				if (infoSection.fileHeaders[i]->fileContents.getFileType() == brsarHexTags::bht_RWSD)
+				{
+					rwsdFileIDs.push_back(i);
+				}
+			}
+
+			// Every file is parsed, compacted and re-exported independently; results are committed serially afterwards.
+			std::vector<rwsd> compactedRWSDs(rwsdFileIDs.size());
+			std::vector<std::vector<unsigned char>> newHeaders(rwsdFileIDs.size());
+			std::vector<std::vector<unsigned char>> newDatas(rwsdFileIDs.size());
+			std::vector<unsigned long> removedWaveCounts(rwsdFileIDs.size(), 0x00);
+			std::vector<unsigned long> bytesReclaimed(rwsdFileIDs.size(), 0x00);
+			std::vector<char> succeeded(rwsdFileIDs.size(), 0);
+			lava::parallelFor(rwsdFileIDs.size(), [&](std::size_t i)
+			{
+				rwsd* currRWSD = &compactedRWSDs[i];
+				if (currRWSD->populate(infoSection.fileHeaders[rwsdFileIDs[i]]->fileContents))
+				{
+					succeeded[i] = currRWSD->removeUnreferencedWaves(&removedWaveCounts[i], &bytesReclaimed[i]);
+					if (succeeded[i] && removedWaveCounts[i] > 0)
+					{
+						newHeaders[i] = currRWSD->fileSectionToVec();
+						newDatas[i] = currRWSD->rawDataSectionToVec();
+						succeeded[i] = !newHeaders[i].empty();
+					}
+					// Only the DATA and WAVE sections are needed past this point.
+					for (std::size_t u = 0; u < currRWSD->waveSection.entries.size(); u++)
+					{
+						currRWSD->waveSection.entries[u].packetContents = wavePacket();
+					}
+				}
+			}, threadCount);
+
+			unsigned long totalBytesReclaimed = 0x00;
+			unsigned long totalWavesRemoved = 0x00;
+			for (std::size_t i = 0; i < rwsdFileIDs.size(); i++)
+			{
+				if (succeeded[i])
+				{
+					if (removedWaveCounts[i] > 0)
+					{
+						brsarFileFileContents* fileContentsPtr = &infoSection.fileHeaders[rwsdFileIDs[i]]->fileContents;
+						fileContentsPtr->header = std::move(newHeaders[i]);
+						fileContentsPtr->data = std::move(newDatas[i]);
+						if (waveReferrerIndexBuilt)
+						{
+							updateWaveReferrerIndex(rwsdFileIDs[i], compactedRWSDs[i]);
+						}
+						totalBytesReclaimed += bytesReclaimed[i];
+						totalWavesRemoved += removedWaveCounts[i];
+						if (reportOut != nullptr)
+						{
+							*reportOut << "RWSD 0x" << numToHexStringWithPadding(rwsdFileIDs[i], 0x03) << ": Removed " << removedWaveCounts[i]
+								<< " unreferenced WAVE(s), reclaimed " << bytesReclaimed[i] << " byte(s).\n";
+						}
+					}
+				}
+				else
+				{
+					result = 0;
+					std::cerr << "[ERROR] Failed to compact RWSD 0x" << numToHexStringWithPadding(rwsdFileIDs[i], 0x03) << "!\n";
+				}
+			}
+			if (totalWavesRemoved > 0)
+			{
+				result &= infoSection.updateGroupEntryAddressValues();
+				signalVirtualFILESectionSizeChange();
+			}
+			if (reportOut != nullptr)
+			{
+				*reportOut << "Removed " << totalWavesRemoved << " unreferenced WAVE(s) across " << rwsdFileIDs.size() << " RWSD(s), reclaimed "
+					<< totalBytesReclaimed << " byte(s) in total.\n";
+			}
+			if (totalBytesReclaimedOut != nullptr)
+			{
+				*totalBytesReclaimedOut = totalBytesReclaimed;
 			}
 
 			return result;
 		}
-		bool rwsd::exportRawDataSection(std::ostream& destinationStream)
+
+		bool brsar::analyzeDuplicateWaves(std::ostream& reportOut, unsigned long threadCount, unsigned long* totalBytesReclaimableOut)
 		{
-			bool result = 0;
+			bool result = 1;
 
-			if (destinationStream.good())
+			flushRWSDCache();
+
+			std::vector<unsigned long> rwsdFileIDs{};
+			for (unsigned long i = 0; i < infoSection.fileHeaders.size(); i++)
 			{
-				for (unsigned long i = 0; i < waveSection.entries.size(); i++)
+				if (infoSection.fileHeaders[i]->fileContents.getFileType() == brsarHexTags::bht_RWSD)
 				{
-					waveInfo* currWave = &waveSection.entries[i];
-					destinationStream.write((const char*)currWave->packetContents.body.data(), currWave->packetContents.body.size());
-					destinationStream.write((const char*)currWave->packetContents.padding.data(), currWave->packetContents.padding.size());
+					rwsdFileIDs.push_back(i);
 				}
-				result = destinationStream.good();
 			}
 
-			return result;
-		}
-		std::vector<unsigned char> rwsd::fileSectionToVec()
-		{
-			std::vector<unsigned char> result;
+			std::vector<unsigned long> mergeableWaveCounts(rwsdFileIDs.size(), 0x00);
+			std::vector<unsigned long> bytesReclaimable(rwsdFileIDs.size(), 0x00);
+			std::vector<char> succeeded(rwsdFileIDs.size(), 0);
+			lava::parallelFor(rwsdFileIDs.size(), [&](std::size_t i)
+			{
+				rwsd tempRWSD;
+				if (tempRWSD.populate(infoSection.fileHeaders[rwsdFileIDs[i]]->fileContents))
+				{
+					succeeded[i] = tempRWSD.mergeDuplicateWaves(&mergeableWaveCounts[i], &bytesReclaimable[i], 1);
+				}
+			}, threadCount);
 
-			std::stringstream tempStream(std::ios_base::in | std::ios_base::out | std::ios_base::binary);
-			if (exportFileSection(tempStream))
+			unsigned long totalBytesReclaimable = 0x00;
+			unsigned long totalMergeableWaves = 0x00;
+			reportOut << "Duplicate WAVE Analysis:\n";
+			for (std::size_t i = 0; i < rwsdFileIDs.size(); i++)
 			{
-				result = streamContentsToVec(tempStream);
+				if (succeeded[i])
+				{
+					if (mergeableWaveCounts[i] > 0)
+					{
+						totalBytesReclaimable += bytesReclaimable[i];
+						totalMergeableWaves += mergeableWaveCounts[i];
+						reportOut << "\tRWSD 0x" << numToHexStringWithPadding(rwsdFileIDs[i], 0x03) << ": " << mergeableWaveCounts[i]
+							<< " duplicate WAVE(s), ~" << bytesReclaimable[i] << " byte(s) reclaimable.\n";
+					}
+				}
+				else
+				{
+					result = 0;
+					std::cerr << "[ERROR] Failed to analyze RWSD 0x" << numToHexStringWithPadding(rwsdFileIDs[i], 0x03) << "!\n";
+				}
+			}
+			reportOut << "Found " << totalMergeableWaves << " duplicate WAVE(s) across " << rwsdFileIDs.size() << " RWSD(s), ~"
+				<< totalBytesReclaimable << " byte(s) reclaimable in total.\n";
+			if (totalBytesReclaimableOut != nullptr)
+			{
+				*totalBytesReclaimableOut = totalBytesReclaimable;
 			}
 
 			return result;
 		}
-		std::vector<unsigned char> rwsd::rawDataSectionToVec()
+
+		bool brsar::canRoundTripFileType(unsigned long fileTypeIn)
 		{
-			std::vector<unsigned char> result;
+			bool result = 0;
 
-			std::stringstream tempStream(std::ios_base::in | std::ios_base::out | std::ios_base::binary);
-			if (exportRawDataSection(tempStream))
+			switch (fileTypeIn)
 			{
-				result = streamContentsToVec(tempStream);
+				case brsarHexTags::bht_RWSD:
+				case brsarHexTags::bht_RBNK:
+				case brsarHexTags::bht_RSEQ:
+				{
+					result = 1;
+					break;
+				}
+				default:
+				{
+					break;
+				}
 			}
 
 			return result;
 		}
-		dsp rwsd::exportWaveRawDataToDSP(unsigned long waveSectionIndex)
+		bool brsar::roundTripFileContents(const brsarFileFileContents& contentsIn, brsarFileFileContents& contentsOut)
 		{
-			dsp result;
+			bool result = 0;
 
-			if (waveSectionIndex < waveSection.entries.size())
+			switch (contentsIn.getFileType())
 			{
-				const waveInfo* targetWaveInfo = &waveSection.entries[waveSectionIndex];
-				result.nibbleCount = targetWaveInfo->nibbles;
-				result.sampleCount = nibblesToSamples(result.nibbleCount);
-				result.nibbleCount = samplesToNibbles(result.sampleCount);
-				result.sampleRate = unsigned long(targetWaveInfo->sampleRate24) << 16;
-				result.sampleRate |= targetWaveInfo->sampleRate;
-				result.loops = targetWaveInfo->looped;
-				result.loopStart = targetWaveInfo->loopStartSample;
-				if (result.loops)
+				case brsarHexTags::bht_RWSD:
+				{
+					rwsd tempRWSD;
+					if (tempRWSD.populate(contentsIn))
+					{
+						contentsOut.header = tempRWSD.fileSectionToVec();
+						contentsOut.data = tempRWSD.rawDataSectionToVec();
+						result = !contentsOut.header.empty();
+					}
+					break;
+				}
+				case brsarHexTags::bht_RBNK:
 				{
-					result.loopEnd = result.sampleCount - 1;
+					rbnk tempRBNK;
+					if (tempRBNK.populate(contentsIn))
+					{
+						contentsOut.header = tempRBNK.fileSectionToVec();
+						contentsOut.data = tempRBNK.rawDataSectionToVec();
+						result = !contentsOut.header.empty();
+					}
+					break;
 				}
-				else
+				case brsarHexTags::bht_RSEQ:
 				{
-					result.loopEnd = 0x00;
+					rseq tempRSEQ;
+					if (tempRSEQ.populate(contentsIn))
+					{
+						// Sequences keep everything in the file section, so any data section is carried over untouched.
+						contentsOut.header = tempRSEQ.fileSectionToVec();
+						contentsOut.data = contentsIn.data;
+						result = !contentsOut.header.empty();
+					}
+					break;
 				}
-				result.soundInfo = targetWaveInfo->adpcmInfoEntries.back();
-				result.body = targetWaveInfo->packetContents.body;
-				//result.body.insert(result.body.end(), targetWaveInfo->packetContents.padding.begin(), targetWaveInfo->packetContents.padding.end());
-				unsigned long desiredLength = nibblesToBytes(result.nibbleCount);
-				if (result.body.size() < desiredLength)
+				default:
 				{
-					result.body.resize(desiredLength);
+					break;
 				}
 			}
 
 			return result;
 		}
-		bool rwsd::exportWaveRawDataToWAV(unsigned long waveSectionIndex, std::string wavOutputPath)
+		bool brsar::verifyRoundTrips(std::vector<brsarRoundTripResult>& resultsOut, unsigned long threadCount)
 		{
-			bool result = 0;
+			bool result = 1;
 
-			dsp conversionDSP = exportWaveRawDataToDSP(waveSectionIndex);
-			if (!conversionDSP.body.empty())
+			flushRWSDCache();
+			resultsOut.clear();
+			resultsOut.resize(infoSection.fileHeaders.size());
+			lava::parallelFor(infoSection.fileHeaders.size(), [&](std::size_t i)
 			{
-				std::ofstream convDSPOut(VGAudioTempConvFilename, std::ios_base::out | std::ios_base::binary);
-				if (convDSPOut.is_open())
+				brsarRoundTripResult* currResult = &resultsOut[i];
+				const brsarFileFileContents* originalContents = &infoSection.fileHeaders[i]->fileContents;
+				currResult->fileID = i;
+				currResult->fileType = originalContents->getFileType();
+				currResult->byteSize = originalContents->size();
+
+				currResult->supported = canRoundTripFileType(currResult->fileType);
+
+				brsarFileFileContents rebuiltContents;
+				currResult->parsed = currResult->supported && roundTripFileContents(*originalContents, rebuiltContents);
+				if (currResult->parsed)
 				{
-					if (conversionDSP.exportContents(convDSPOut))
+					auto findFirstMismatch = [](const std::vector<unsigned char>& originalIn, const std::vector<unsigned char>& rebuiltIn)
 					{
-						convDSPOut.close();
-						system(lava::brawl::generateVGAudioDSPToWavCommand(VGAudioTempConvFilename, wavOutputPath).c_str());
-						result = std::filesystem::is_regular_file(wavOutputPath);
-					}
-					std::filesystem::remove(VGAudioTempConvFilename);
+						unsigned long result = ULONG_MAX;
+
+						std::size_t comparedLength = std::min(originalIn.size(), rebuiltIn.size());
+						auto mismatch = std::mismatch(originalIn.begin(), originalIn.begin() + comparedLength, rebuiltIn.begin());
+						if (mismatch.first != originalIn.begin() + comparedLength || originalIn.size() != rebuiltIn.size())
+						{
+							result = mismatch.first - originalIn.begin();
+						}
+
+						return result;
+					};
+					currResult->firstHeaderMismatch = findFirstMismatch(originalContents->header, rebuiltContents.header);
+					currResult->firstDataMismatch = findFirstMismatch(originalContents->data, rebuiltContents.data);
+				}
+			}, threadCount);
+
+			for (std::size_t i = 0; i < resultsOut.size(); i++)
+			{
+				if (resultsOut[i].supported)
+				{
+					result &= resultsOut[i].matches();
 				}
 			}
 
 			return result;
 		}
 
-		bool rwsd::updateWaveEntryDataLocations()
+		bool brsar::scanRSEQs(const std::function<bool(unsigned long, rseqEventIterator)>& scanFuncIn, unsigned long threadCount,
+			std::vector<std::pair<unsigned long, bool>>* succeededOut)
 		{
 			bool result = 1;
 
-			unsigned long positionAccumulator = 0x00;
-			for (unsigned long i = 0; i < waveSection.entries.size(); i++)
+			std::vector<unsigned long> sequenceFileIDs{};
+			for (std::size_t i = 0; i < infoSection.fileHeaders.size(); i++)
 			{
-				waveInfo* currEntry = &waveSection.entries[i];
-				currEntry->dataLocation = positionAccumulator;
-				positionAccumulator += currEntry->packetContents.body.size() + currEntry->packetContents.padding.size();
+				if (infoSection.fileHeaders[i]->fileContents.getFileType() == brsarHexTags::bht_RSEQ)
+				{
+					sequenceFileIDs.push_back(i);
+				}
+			}
+
+			// Each scan runs directly over the file's own bytes, so there's nothing to parse or copy first.
+			std::vector<char> scanSucceeded(sequenceFileIDs.size(), 0);
+			lava::parallelFor(sequenceFileIDs.size(), [&](std::size_t i)
+			{
+				const unsigned char* sequenceData = nullptr;
+				std::size_t sequenceDataLength = 0x00;
+				if (rseq::getSequenceDataSpan(infoSection.fileHeaders[sequenceFileIDs[i]]->fileContents.header, sequenceData, sequenceDataLength))
+				{
+					scanSucceeded[i] = scanFuncIn(sequenceFileIDs[i], rseqEventIterator(sequenceData, sequenceDataLength));
+				}
+			}, threadCount);
+
+			if (succeededOut != nullptr)
+			{
+				succeededOut->clear();
+			}
+			for (std::size_t i = 0; i < sequenceFileIDs.size(); i++)
+			{
+				result &= scanSucceeded[i] != 0;
+				if (succeededOut != nullptr)
+				{
+					succeededOut->push_back(std::make_pair(sequenceFileIDs[i], scanSucceeded[i] != 0));
+				}
 			}
 
 			return result;
 		}
-		waveInfo* rwsd::getWaveInfoAssociatedWithDataInfo(unsigned long dataSectionIndex)
+		bool brsar::getRSEQProgramUsage(std::unordered_map<unsigned long, std::vector<unsigned long>>& programsOut, unsigned long threadCount)
 		{
-			waveInfo* result = nullptr;
+			bool result = 0;
 
-			if (dataSectionIndex < dataSection.entries.size())
+			// Entries are created up front so that the scans below only ever look up existing keys, which is safe to do concurrently.
+			programsOut.clear();
+			for (std::size_t i = 0; i < infoSection.fileHeaders.size(); i++)
 			{
-				unsigned long waveIndex = dataSection.entries[dataSectionIndex].ntWaveIndex;
-				if (waveIndex < waveSection.entries.size())
+				if (infoSection.fileHeaders[i]->fileContents.getFileType() == brsarHexTags::bht_RSEQ)
 				{
-					result = &waveSection.entries[waveIndex];
+					programsOut[i];
 				}
 			}
+			result = scanRSEQs([&programsOut](unsigned long fileIDIn, rseqEventIterator eventsIn)
+			{
+				return rseq::getProgramsUsed(eventsIn, programsOut.find(fileIDIn)->second);
+			}, threadCount);
 
 			return result;
 		}
-		bool rwsd::summarize(std::ostream& output)
+		bool brsar::exportWAVs(const std::vector<std::pair<unsigned long, std::string>>& fileIDsToOutputDirsIn, unsigned long threadCount,
+			brsarWaveExportStats* statsOut, std::ostream* progressOut)
 		{
 			bool result = 0;
 
-			if (output.good() && address != UINT_MAX)
+			auto startTime = std::chrono::steady_clock::now();
+			// Edits sitting in the cache haven't reached the file contents yet, so write them back before reading anything.
+			flushRWSDCache();
+
+			struct waveDecodeTask
 			{
-				output << "RWSD Content Summary - lavaBRSARLib " << version << "\n";
-				output << "\nNote: In the following summarization, all addresses are relative to the start of the described RWSD file.\n";
-				output << "Additionally, any absolute Wave Content Address values assume the wave content block directly follows the WAVE section.\n";
-				output << "While this is always true of individual RWSD files produced with this library, it *is not guaranteed* in any other case!\n";
-				output << "\nStructure Overview:\n";
-				output << "\tTotal Length/End:\t0x" << lava::numToHexStringWithPadding(size(), 0x08) << " / 0x" << lava::numToHexStringWithPadding(size(), 0x08) << "\n";
-				output << "\tData Section Offset:\t0x" << lava::numToHexStringWithPadding(getDATASectionOffset(), 0x08) << "\n";
-				output << "\tData Section Length/End:\t0x" << lava::numToHexStringWithPadding(getDATASectionSize(), 0x08) << " / 0x" << lava::numToHexStringWithPadding(getDATASectionOffset() + getDATASectionSize(), 0x08) << "\n";
-				output << "\tData Entry Count:\t\t0x" << lava::numToHexStringWithPadding(dataSection.entries.size(), 0x04) << "\n";
-				output << "\tWave Section Offset:\t0x" << lava::numToHexStringWithPadding(getWAVESectionOffset(), 0x08) << "\n";
-				output << "\tWave Section Length/End:\t0x" << lava::numToHexStringWithPadding(getWAVESectionSize(), 0x08) << " / 0x" << lava::numToHexStringWithPadding(getWAVESectionOffset() + getWAVESectionSize(), 0x08) << "\n";
-				output << "\tWave Entry Count:\t\t0x" << lava::numToHexStringWithPadding(waveSection.entries.size(), 0x04) << "\n";
-				output << "\nEntry Summary:\n";
+				std::shared_ptr<const rwsd> sourceRWSD{};
+				unsigned long waveIndex = ULONG_MAX;
+				std::string outputPath = "";
+			};
+			struct waveWriteTask
+			{
+				wav decodedWave{};
+				std::string outputPath = "";
+			};
 
-				std::unordered_map<unsigned long, std::vector<unsigned long>> waveIndecesToReferrerDataIndeces{};
+			// One thread parses and one writes; everything else goes to decoding, which is where nearly all the work is.
+			unsigned long availableThreads = (threadCount != 0) ? threadCount : getDefaultThreadCount();
+			unsigned long decodeThreadCount = (availableThreads > 2) ? availableThreads - 2 : 1;
+			boundedQueue<waveDecodeTask> decodeQueue(decodeThreadCount * 2);
+			boundedQueue<waveWriteTask> writeQueue(decodeThreadCount * 2);
+			std::atomic<unsigned long> filesParsed(0);
+			std::atomic<unsigned long> filesFailed(0);
+			std::atomic<unsigned long> wavesExported(0);
+			std::atomic<unsigned long> wavesFailed(0);
 
-				std::vector<dataInfo>* dataVecPtr = &dataSection.entries;
-				std::vector<waveInfo>* waveVecPtr = &waveSection.entries;
-				brawlReferenceVector* dataRefVecPtr = &dataSection.entryReferences;
-				std::vector<unsigned long> waveOffVec = waveSection.calculateOffsetVector();
+			std::thread parseThread([&]()
+			{
+				for (std::size_t i = 0; i < fileIDsToOutputDirsIn.size(); i++)
+				{
+					unsigned long fileID = fileIDsToOutputDirsIn[i].first;
+					std::string outputDirectory = fileIDsToOutputDirsIn[i].second;
+					if (!outputDirectory.empty() && outputDirectory.back() != '/' && outputDirectory.back() != '\\')
+					{
+						outputDirectory += "/";
+					}
 
-				unsigned long waveDataBaseAddress = getWAVESectionOffset() + getWAVESectionSize();
+					brsarInfoFileHeader* fileHeader = infoSection.getFileHeaderPointer(fileID);
+					std::shared_ptr<rwsd> parsedRWSD = std::make_shared<rwsd>();
+					bool parsed = fileHeader != nullptr && fileHeader->fileContents.getFileType() == brsarHexTags::bht_RWSD
+						&& parsedRWSD->populate(fileHeader->fileContents);
+					std::error_code directoryError;
+					if (parsed && !outputDirectory.empty())
+					{
+						std::filesystem::create_directories(outputDirectory, directoryError);
+					}
+					if (parsed && !directoryError)
+					{
+						filesParsed++;
+						for (unsigned long u = 0; u < parsedRWSD->waveSection.entries.size(); u++)
+						{
+							waveDecodeTask currTask;
+							currTask.sourceRWSD = parsedRWSD;
+							currTask.waveIndex = u;
+							currTask.outputPath = outputDirectory + "file_" + numToDecStringWithPadding(fileID, 3) + "_wav_" + numToDecStringWithPadding(u, 3) + ".wav";
+							decodeQueue.push(std::move(currTask));
+						}
+					}
+					else
+					{
+						filesFailed++;
+						std::cerr << "[ERROR] Unable to export waves from File 0x" << numToHexStringWithPadding(fileID, 0x03) << "!\n";
+					}
+				}
+				decodeQueue.close();
+			});
 
-				for (unsigned long u = 0; u < dataVecPtr->size(); u++)
+			std::vector<std::thread> decodeThreads{};
+			for (unsigned long i = 0; i < decodeThreadCount; i++)
+			{
+				decodeThreads.emplace_back([&]()
 				{
-					dataInfo* currDataEntry = &(*dataVecPtr)[u];
-					output << "\tData Entry 0x" << lava::numToHexStringWithPadding(u, 0x04) << "\n";
-					output << "\t\tOffset / Address:\t0x" << lava::numToHexStringWithPadding(dataRefVecPtr->refs[u].address, 0x08) << " / 0x" << lava::numToHexStringWithPadding(getDATASectionOffset() + 0x08 + dataRefVecPtr->refs[u].address, 0x08) << "\n";
-					output << "\t\tAssociated Wave ID:\t0x" << lava::numToHexStringWithPadding(currDataEntry->ntWaveIndex, 0x04) << "\n";
-					if (currDataEntry->ntWaveIndex != ULONG_MAX)
+					waveDecodeTask currTask;
+					while (decodeQueue.pop(currTask))
 					{
-						auto emplaceResult = waveIndecesToReferrerDataIndeces.emplace(std::make_pair(currDataEntry->ntWaveIndex, std::vector<unsigned long>()));
-						if (emplaceResult.second)
+						waveWriteTask writeTask;
+						// Each wave already has a thread to itself, so its channels are decoded serially.
+						if (currTask.sourceRWSD->waveSection.exportWaveRawDataToWAV(currTask.waveIndex, writeTask.decodedWave, 1))
 						{
-							waveInfo* currWaveEntry = &(*waveVecPtr)[currDataEntry->ntWaveIndex];
-							output << "\t\tWave Entry Offset / Address:\t0x" << lava::numToHexStringWithPadding(waveOffVec[currDataEntry->ntWaveIndex], 0x08) << " / 0x" << lava::numToHexStringWithPadding(getWAVESectionOffset() + waveOffVec[currDataEntry->ntWaveIndex], 0x08) << "\n";
-							output << "\t\tWave Contents Offset / Address:\t0x" << lava::numToHexStringWithPadding(currWaveEntry->dataLocation, 0x08) << " / 0x" << lava::numToHexStringWithPadding(waveDataBaseAddress + currWaveEntry->dataLocation, 0x08) << "\n";
-							output << "\t\tWave Contents Length / End:\t0x" << lava::numToHexStringWithPadding(currWaveEntry->getAudioLengthInBytes(), 0x04) << " / 0x" << lava::numToHexStringWithPadding(waveDataBaseAddress + currWaveEntry->dataLocation + currWaveEntry->getAudioLengthInBytes(), 0x08) << "\n";
-							emplaceResult.first->second.push_back(u);
+							writeTask.outputPath = std::move(currTask.outputPath);
+							writeQueue.push(std::move(writeTask));
 						}
 						else
 						{
-							output << "\t\tSkipping Wave Summary, see Data Entry 0x" << lava::numToHexStringWithPadding(emplaceResult.first->second.front(), 0x04) << "\n";
-							emplaceResult.first->second.push_back(u);
+							wavesFailed++;
+							std::cerr << "[ERROR] Unable to decode \"" << currTask.outputPath << "\"!\n";
+						}
+						// Drop this task's reference now rather than at the next pop, so finished RWSDs are freed promptly.
+						currTask.sourceRWSD.reset();
+					}
+				});
+			}
+
+			std::thread writeThread([&]()
+			{
+				waveWriteTask currTask;
+				while (writeQueue.pop(currTask))
+				{
+					if (currTask.decodedWave.exportContents(currTask.outputPath))
+					{
+						wavesExported++;
+						if (progressOut != nullptr)
+						{
+							*progressOut << "Exported \"" << currTask.outputPath << "\".\n";
 						}
 					}
+					else
+					{
+						wavesFailed++;
+						std::cerr << "[ERROR] Unable to write \"" << currTask.outputPath << "\"!\n";
+					}
 				}
-				result = output.good();
+			});
+
+			parseThread.join();
+			for (std::size_t i = 0; i < decodeThreads.size(); i++)
+			{
+				decodeThreads[i].join();
+			}
+			writeQueue.close();
+			writeThread.join();
+
+			brsarWaveExportStats stats;
+			stats.filesParsed = filesParsed;
+			stats.filesFailed = filesFailed;
+			stats.wavesExported = wavesExported;
+			stats.wavesFailed = wavesFailed;
+			stats.secondsElapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+			if (statsOut != nullptr)
+			{
+				*statsOut = stats;
 			}
+			result = stats.filesFailed == 0 && stats.wavesFailed == 0;
 
 			return result;
 		}
-		bool rwsd::summarize(std::string filepath)
+		bool brsar::exportWAVs(const std::vector<unsigned long>& fileIDsIn, std::string outputDirectory, unsigned long threadCount,
+			brsarWaveExportStats* statsOut, std::ostream* progressOut)
+		{
+			std::vector<std::pair<unsigned long, std::string>> fileIDsToOutputDirs{};
+			for (std::size_t i = 0; i < fileIDsIn.size(); i++)
+			{
+				fileIDsToOutputDirs.push_back(std::make_pair(fileIDsIn[i], outputDirectory));
+			}
+			return exportWAVs(fileIDsToOutputDirs, threadCount, statsOut, progressOut);
+		}
+
+		bool brsar::overwriteFile(const std::vector<unsigned char>& headerIn, const std::vector<unsigned char>& dataIn, unsigned long fileIDIn)
 		{
 			bool result = 0;
 
-			std::ofstream output(filepath, std::ios_base::out);
-			if (output.is_open())
+			// Any cached parse of this file is now stale, so discard it rather than write it back.
+			dropRWSDCacheEntry(fileIDIn);
+			result = replaceFileContents(headerIn, dataIn, fileIDIn);
+			if (result)
 			{
-				result = summarize(output);
+				// Keep the wave referrer index in sync if the file was an RWSD
+				refreshWaveReferrerIndex(fileIDIn);
 			}
 
 			return result;
 		}
 
-		bool rwsd::overwriteWave(unsigned long waveSectionIndex, const waveInfo& waveInfoIn)
+		bool brsar::writeBackRWSDCacheEntry(rwsdCacheEntry& entryIn)
 		{
-			bool result = 0;
+			bool result = 1;
 
-			if (waveSectionIndex < waveSection.entries.size())
+			if (entryIn.dirty)
 			{
-				waveSection.entries[waveSectionIndex] = waveInfoIn;
-				result = updateWaveEntryDataLocations();
+				std::vector<unsigned char> newHeader = entryIn.parsedRWSD->fileSectionToVec();
+				std::vector<unsigned char> newData = entryIn.parsedRWSD->rawDataSectionToVec();
+				rwsdCacheCurrentBytes -= entryIn.byteSize;
+				entryIn.byteSize = newHeader.size() + newData.size();
+				rwsdCacheCurrentBytes += entryIn.byteSize;
+				result = replaceFileContents(newHeader, newData, entryIn.fileID);
+				if (result)
+				{
+					entryIn.dirty = 0;
+					if (waveReferrerIndexBuilt)
+					{
+						updateWaveReferrerIndex(entryIn.fileID, *entryIn.parsedRWSD);
+					}
+				}
+				else
+				{
+					std::cerr << "[ERROR] Failed to write cached RWSD (File ID 0x" << numToHexStringWithPadding(entryIn.fileID, 0x03) << ") back into BRSAR!\n";
+				}
 			}
 
 			return result;
 		}
-		bool rwsd::overwriteAllWaves(const waveInfo waveInfoIn)
+		void brsar::evictRWSDCacheEntries()
 		{
-			bool result = 0;
+			// Never evict the most recently used entry, it was very likely just handed out.
+			while (rwsdCacheCurrentBytes > rwsdCacheByteBudget && rwsdCache.size() > 1)
+			{
+				rwsdCacheEntry* lruEntry = &rwsdCache.back();
+				writeBackRWSDCacheEntry(*lruEntry);
+				rwsdCacheCurrentBytes -= lruEntry->byteSize;
+				fileIDsToRWSDCacheEntries.erase(lruEntry->fileID);
+				rwsdCache.pop_back();
+			}
+		}
+		rwsd* brsar::getCachedRWSD(unsigned long fileIDIn, bool forEditing)
+		{
+			rwsd* result = nullptr;
 
-			for (std::size_t i = 0; i < waveSection.entries.size(); i++)
+			auto findResult = fileIDsToRWSDCacheEntries.find(fileIDIn);
+			if (findResult != fileIDsToRWSDCacheEntries.end())
 			{
-				waveSection.entries[i] = waveInfoIn;
+				// Move the entry up to the front of the list.
+				rwsdCache.splice(rwsdCache.begin(), rwsdCache, findResult->second);
+				rwsdCache.front().dirty |= forEditing;
+				result = rwsdCache.front().parsedRWSD.get();
+			}
+			else
+			{
+				brsarInfoFileHeader* fileHeaderPtr = infoSection.getFileHeaderPointer(fileIDIn);
+				if (fileHeaderPtr != nullptr && fileHeaderPtr->fileContents.getFileType() == brsarHexTags::bht_RWSD)
+				{
+					std::unique_ptr<rwsd> parsedRWSD = std::make_unique<rwsd>();
+					if (parsedRWSD->populate(fileHeaderPtr->fileContents))
+					{
+						rwsdCache.emplace_front();
+						rwsdCacheEntry* newEntry = &rwsdCache.front();
+						newEntry->fileID = fileIDIn;
+						newEntry->parsedRWSD = std::move(parsedRWSD);
+						newEntry->byteSize = fileHeaderPtr->fileContents.header.size() + fileHeaderPtr->fileContents.data.size();
+						newEntry->dirty = forEditing;
+						rwsdCacheCurrentBytes += newEntry->byteSize;
+						fileIDsToRWSDCacheEntries[fileIDIn] = rwsdCache.begin();
+						result = newEntry->parsedRWSD.get();
+						evictRWSDCacheEntries();
+					}
+				}
 			}
-			result = updateWaveEntryDataLocations();
 
 			return result;
 		}
-		bool rwsd::overwriteWaveRawData(unsigned long waveSectionIndex, const std::vector<unsigned char>& rawDataIn)
+		bool brsar::flushRWSDCacheEntry(unsigned long fileIDIn)
 		{
-			bool result = 0;
+			bool result = 1;
 
-			if (waveSectionIndex < waveSection.entries.size())
+			auto findResult = fileIDsToRWSDCacheEntries.find(fileIDIn);
+			if (findResult != fileIDsToRWSDCacheEntries.end())
 			{
-				waveInfo* targetWaveInfo = &waveSection.entries[waveSectionIndex];
-				targetWaveInfo->packetContents.body = rawDataIn;
-				targetWaveInfo->packetContents.padding = std::vector<unsigned char> (0x10 - (targetWaveInfo->packetContents.body.size() % 0x10), 0x00);
-				targetWaveInfo->nibbles = targetWaveInfo->packetContents.body.size() * 2;
-				result = updateWaveEntryDataLocations();
+				result = writeBackRWSDCacheEntry(*findResult->second);
+			}
+
+			return result;
+		}
+		bool brsar::flushRWSDCache()
+		{
+			bool result = 1;
+
+			for (auto i = rwsdCache.begin(); i != rwsdCache.end(); i++)
+			{
+				result &= writeBackRWSDCacheEntry(*i);
+			}
+
+			return result;
+		}
+		void brsar::dropRWSDCacheEntry(unsigned long fileIDIn)
+		{
+			auto findResult = fileIDsToRWSDCacheEntries.find(fileIDIn);
+			if (findResult != fileIDsToRWSDCacheEntries.end())
+			{
+				rwsdCacheCurrentBytes -= findResult->second->byteSize;
+				rwsdCache.erase(findResult->second);
+				fileIDsToRWSDCacheEntries.erase(findResult);
+			}
+		}
+		bool brsar::clearRWSDCache(bool flushFirst)
+		{
+			bool result = 1;
+
+			if (flushFirst)
+			{
+				result = flushRWSDCache();
 			}
+			rwsdCache.clear();
+			fileIDsToRWSDCacheEntries.clear();
+			rwsdCacheCurrentBytes = 0x00;
 
 			return result;
 		}
-		bool rwsd::overwriteWaveRawDataWithDSP(unsigned long waveSectionIndex, const dsp& dspIn)
+		void brsar::setRWSDCacheByteBudget(unsigned long budgetIn)
+		{
+			rwsdCacheByteBudget = budgetIn;
+			evictRWSDCacheEntries();
+		}
+		unsigned long brsar::getRWSDCacheByteBudget() const
+		{
+			return rwsdCacheByteBudget;
+		}
+		brsarInfoFileHeader* brsar::beginInPlaceRWSDEdit(unsigned long fileIDIn)
 		{
-			bool result = 0;
+			brsarInfoFileHeader* result = nullptr;
 
-			if (waveSectionIndex < waveSection.entries.size())
+			// Commit any pending edits first, then discard the cached parse since it's about to go stale.
+			if (flushRWSDCacheEntry(fileIDIn))
 			{
-				waveInfo* targetWaveInfo = &waveSection.entries[waveSectionIndex];
-				targetWaveInfo->encoding = 2;
-				targetWaveInfo->channels = 1;
-				targetWaveInfo->looped = dspIn.loops;
-				targetWaveInfo->loopStartSample = dspIn.loopStart;
-				targetWaveInfo->nibbles = dspIn.nibbleCount;
-				targetWaveInfo->sampleRate24 = dspIn.sampleRate >> 16;
-				targetWaveInfo->sampleRate = 0x0000FFFF & dspIn.sampleRate;
-				targetWaveInfo->channelInfoTable.resize(1);
-				targetWaveInfo->channelInfoEntries.resize(1);
-				targetWaveInfo->adpcmInfoEntries.resize(1);
-				targetWaveInfo->adpcmInfoEntries.back() = dspIn.soundInfo;
-				result = overwriteWaveRawData(waveSectionIndex, dspIn.body);
+				dropRWSDCacheEntry(fileIDIn);
+				result = infoSection.getFileHeaderPointer(fileIDIn);
 			}
 
 			return result;
 		}
-		bool rwsd::overwriteWaveRawDataWithDSP(unsigned long waveSectionIndex, std::string dspPathIn)
+		bool brsar::finishInPlaceRWSDEdit(unsigned long fileIDIn)
 		{
-			bool result = 0;
+			bool result = infoSection.updateGroupEntryAddressValues();
 
-			if (std::filesystem::is_regular_file(dspPathIn))
-			{
-				dsp tempDSP;
-				if (tempDSP.populate(dspPathIn, 0x00))
-				{
-					result = overwriteWaveRawDataWithDSP(waveSectionIndex, tempDSP);
-				}
-			}
+			signalVirtualFILESectionSizeChange();
+			refreshWaveReferrerIndex(fileIDIn);
 
 			return result;
 		}
-		bool rwsd::overwriteWaveRawDataWithWAV(unsigned long waveSectionIndex, std::string wavPathIn)
+		bool brsar::getRWSDWaveSection(const brsarFileFileContents& contentsIn, rwsdWaveSection& sectionOut)
 		{
 			bool result = 0;
 
-			if (std::filesystem::is_regular_file(wavPathIn))
+			if (contentsIn.getFileType() == brsarHexTags::bht_RWSD)
 			{
-				system(lava::brawl::generateVGAudioWavToDSPCommand(wavPathIn, VGAudioTempConvFilename).c_str());
-				if (std::filesystem::is_regular_file(VGAudioTempConvFilename))
+				byteArray headerArr(contentsIn.header.data(), contentsIn.header.size());
+				unsigned long waveSectionOffset = headerArr.getLong(0x18);
+				unsigned long waveSectionLength = headerArr.getLong(0x1C);
+				result = waveSectionOffset >= 0x20 && (waveSectionOffset + waveSectionLength) <= headerArr.size() && sectionOut.populate(headerArr, waveSectionOffset);
+				for (std::size_t i = 0; result && i < sectionOut.entries.size(); i++)
 				{
-					result = overwriteWaveRawDataWithDSP(waveSectionIndex, VGAudioTempConvFilename);
-					std::filesystem::remove(VGAudioTempConvFilename);
+					result = (sectionOut.entries[i].address + sectionOut.entries[i].size()) <= (waveSectionOffset + waveSectionLength);
 				}
 			}
 
 			return result;
 		}
-
-		bool rwsd::createNewWaveEntry(const waveInfo& sourceWave, bool pushFront)
+		unsigned long brsar::getRWSDWavePacketEnd(const rwsdWaveSection& sectionIn, unsigned long waveIndexIn, unsigned long rawDataLengthIn)
 		{
-			bool result = 1;
+			unsigned long result = rawDataLengthIn;
 
-			if (pushFront)
+			// Packets needn't be stored in index order, so a packet runs up to whichever other packet starts soonest after it.
+			unsigned long packetStart = sectionIn.entries[waveIndexIn].dataLocation;
+			for (std::size_t i = 0; i < sectionIn.entries.size(); i++)
 			{
-				// Add entry to front of WAVE entry vec.
-				waveSection.waveEntryPushFront(sourceWave);
-				// Since we've added the entry to the front, the indices for every other sound have been shifted up by 1
-				// So we need to iterate through all the DATA entries and shift their indeces.
-				for (unsigned long i = 0; i < dataSection.entries.size(); i++)
+				unsigned long currDataLocation = sectionIn.entries[i].dataLocation;
+				if (currDataLocation > packetStart && currDataLocation < result)
 				{
-					dataSection.entries[i].ntWaveIndex++;
+					result = currDataLocation;
 				}
 			}
-			else
-			{
-				// Add entry to back of WAVE entry vec.
-				waveSection.waveEntryPushBack(sourceWave);
-			}
-			// Recalculate WAVE entry data locations.
-			updateWaveEntryDataLocations();
-			signalWAVESectionSizeChange();
 
 			return result;
 		}
-		bool rwsd::createNewWaveEntries(const waveInfo sourceWave, unsigned char cloneCount, bool pushFront)
+		bool brsar::rebuildRWSDWaveSection(brsarFileFileContents& contentsIn, rwsdWaveSection& sectionIn)
 		{
-			bool result = 1;
+			bool result = 0;
 
-			// Just makes sure that we're not having to repeatedly reallocate space for the vector as we add entries.
-			// Also, note that we can't take sourceWave as a reference, because if we take in an element from the vector as ref,
-			// then reallocate the vector, we'll invalidate our reference.
-			std::size_t endSize = waveSection.entries.size() + cloneCount;
-			if (waveSection.entries.capacity() <= endSize)
-			{
-				waveSection.entries.reserve(endSize);
-			}
-			for (unsigned char i = 0; i < cloneCount; i++)
+			std::vector<unsigned char>* header = &contentsIn.header;
+			unsigned long waveSectionOffset = getFundamentalFromVec<unsigned long>(*header, 0x18);
+			unsigned long oldWaveSectionLength = getFundamentalFromVec<unsigned long>(*header, 0x1C);
+			if (waveSectionOffset >= 0x20 && (waveSectionOffset + oldWaveSectionLength) <= header->size())
 			{
-				result &= createNewWaveEntry(sourceWave, pushFront);
+				std::stringstream tempStream(std::ios_base::in | std::ios_base::out | std::ios_base::binary);
+				if (sectionIn.exportContents(tempStream))
+				{
+					// The WAVE section needn't be the last one in the header, so the new one is spliced in over the old one,
+					// and everything else is carried over as is, save for the length fields and any offset past the WAVE section.
+					std::vector<unsigned char> newWaveSection = streamContentsToVec(tempStream);
+					signed long lengthChange = signed long(newWaveSection.size()) - signed long(oldWaveSectionLength);
+					header->erase(header->begin() + waveSectionOffset, header->begin() + waveSectionOffset + oldWaveSectionLength);
+					header->insert(header->begin() + waveSectionOffset, newWaveSection.begin(), newWaveSection.end());
+					lava::writeFundamentalToBuffer<unsigned long>(header->size(), header->data() + 0x08);
+					lava::writeFundamentalToBuffer<unsigned long>(newWaveSection.size(), header->data() + 0x1C);
+					unsigned long dataSectionOffset = getFundamentalFromVec<unsigned long>(*header, 0x10);
+					if (dataSectionOffset > waveSectionOffset)
+					{
+						lava::writeFundamentalToBuffer<unsigned long>(dataSectionOffset + lengthChange, header->data() + 0x10);
+					}
+					result = 1;
+				}
 			}
 
 			return result;
 		}
-		bool rwsd::grantDataEntryUniqueWave(unsigned long dataSectionIndex, const waveInfo& sourceWave, bool pushFront)
+		bool brsar::rwsdAppendWaveEntries(brsarFileFileContents& contentsIn, rwsdWaveSection& sectionIn, const waveInfo& newWaveIn,
+			const std::vector<unsigned char>& newPacketIn, unsigned long countIn)
 		{
 			bool result = 0;
 
-			if (createNewWaveEntry(sourceWave, pushFront))
+			std::vector<unsigned char>* rawData = &contentsIn.data;
+			waveInfo newWave;
+			newWave.copyOverWaveInfoProperties(newWaveIn);
+			newWave.dataLocationType = newWaveIn.dataLocationType;
+			sectionIn.entries.reserve(sectionIn.entries.size() + countIn);
+			for (unsigned long i = 0; i < countIn; i++)
 			{
-				if (pushFront)
-				{
-					dataSection.entries[dataSectionIndex].ntWaveIndex = 0;
-				}
-				else
+				// New packets all go on the end of the raw data, so every existing wave's data location stays valid.
+				newWave.dataLocation = rawData->size() + (i * newPacketIn.size());
+				sectionIn.entries.push_back(newWave);
+			}
+			result = rebuildRWSDWaveSection(contentsIn, sectionIn);
+			if (result)
+			{
+				rawData->reserve(rawData->size() + (countIn * newPacketIn.size()));
+				for (unsigned long i = 0; i < countIn; i++)
 				{
-					dataSection.entries[dataSectionIndex].ntWaveIndex = waveSection.entries.size() - 1;
+					rawData->insert(rawData->end(), newPacketIn.begin(), newPacketIn.end());
 				}
-				result = 1;
 			}
 
 			return result;
 		}
-
-		bool rwsd::hollowOutWAVEEntry(unsigned long waveID)
+		bool brsar::rwsdAppendWavesToContents(brsarFileFileContents& contentsIn, const waveInfo& sourceWaveIn, unsigned long countIn)
 		{
 			bool result = 0;
 
-			if (waveSection.entries.size() > waveID)
+			rwsdWaveSection waveSection;
+			if (countIn > 0 && getRWSDWaveSection(contentsIn, waveSection))
 			{
-				result = 1;
-				waveSection.entries[waveID].hollowOut();
+				std::vector<unsigned char> newPacket = sourceWaveIn.packetContents.body;
+				newPacket.insert(newPacket.end(), sourceWaveIn.packetContents.padding.begin(), sourceWaveIn.packetContents.padding.end());
+				result = rwsdAppendWaveEntries(contentsIn, waveSection, sourceWaveIn, newPacket, countIn);
 			}
 
 			return result;
 		}
-		bool rwsd::cutDownWaveSection(unsigned long remainingWaveCount, bool zeroOutWaveContent)
+		bool brsar::rwsdAppendWavesToContents(brsarFileFileContents& contentsIn, unsigned long sourceWaveIndexIn, unsigned long countIn, bool hollowOutNewWaves)
 		{
 			bool result = 0;
 
-			if (remainingWaveCount > 0)
+			rwsdWaveSection waveSection;
+			if (countIn > 0 && getRWSDWaveSection(contentsIn, waveSection) && sourceWaveIndexIn < waveSection.entries.size())
 			{
-				if (waveSection.entries.size() > remainingWaveCount)
-				{
-					waveSection.entries.resize(remainingWaveCount);
-				}
-				for (std::size_t i = 0; i < dataSection.entries.size(); i++)
+				waveInfo newWave = waveSection.entries[sourceWaveIndexIn];
+				std::vector<unsigned char> newPacket{};
+				if (hollowOutNewWaves)
 				{
-					if (dataSection.entries[i].ntWaveIndex >= remainingWaveCount)
-					{
-						dataSection.entries[i].ntWaveIndex = 0;
-					}
+					newWave.hollowOut();
+					newPacket = newWave.packetContents.body;
+					newPacket.insert(newPacket.end(), newWave.packetContents.padding.begin(), newWave.packetContents.padding.end());
+					result = 1;
 				}
-				if (zeroOutWaveContent)
+				else
 				{
-					for (std::size_t i = 0; i < waveSection.entries.size(); i++)
+					std::vector<unsigned char>* rawData = &contentsIn.data;
+					unsigned long packetStart = newWave.dataLocation;
+					unsigned long packetEnd = getRWSDWavePacketEnd(waveSection, sourceWaveIndexIn, rawData->size());
+					result = packetStart <= packetEnd;
+					if (result)
 					{
-						hollowOutWAVEEntry(i);
+						newPacket.assign(rawData->begin() + packetStart, rawData->begin() + packetEnd);
 					}
 				}
-				result = updateWaveEntryDataLocations();
-				signalDATASectionSizeChange();
-				signalWAVESectionSizeChange();
+				result = result && rwsdAppendWaveEntries(contentsIn, waveSection, newWave, newPacket, countIn);
 			}
 
 			return result;
 		}
-
-		/* RWSD */
-
-		/* BRSAR File Section */
-
-
-
-		/* BRSAR */
-
-		unsigned long brsar::size()
-		{
-			return headerLength + getSYMBSectionSize() + getINFOSectionSize() + getVirtualFILESectionSize();
-		}
-		bool brsar::init(std::string filePathIn)
+		bool brsar::rwsdTruncateWavesInContents(brsarFileFileContents& contentsIn, unsigned long remainingWaveCountIn, bool zeroOutRemainingWaves)
 		{
 			bool result = 0;
-			std::ifstream fileIn;
-			fileIn.open(filePathIn, std::ios_base::in | std::ios_base::binary);
-			if (fileIn.is_open())
+
+			rwsdWaveSection waveSection;
+			std::vector<dataInfoView> dataEntryViews{};
+			if (remainingWaveCountIn > 0 && getRWSDWaveSection(contentsIn, waveSection) && rwsd::getDataEntryViews(contentsIn.header, dataEntryViews))
 			{
-				std::cout << "Parsing \"" << filePathIn << "\"...\n";
-				byteArray contents(fileIn);
-				fileIn.close();
-				if (contents.populated() && contents.getLong(0x00) == brsarHexTags::bht_RSAR)
+				// Refuse to remove a wave which a DATA entry still uses, rather than quietly pointing the entry at another one.
+				result = 1;
+				for (std::size_t i = 0; result && i < dataEntryViews.size(); i++)
 				{
-					std::size_t cursor = 0x04;
-					result = 1;
-					byteOrderMarker = contents.getShort(cursor, &cursor);
-					version = contents.getShort(cursor, &cursor);
-					contents.getLong(cursor, &cursor); // Move Past Length Entry
-					headerLength = contents.getShort(cursor, &cursor);
-					sectionCount = contents.getShort(cursor, &cursor);
+					result = !dataEntryViews[i].valid() || dataEntryViews[i].getWaveIndex() < remainingWaveCountIn;
+				}
 
-					result &= symbSection.populate(*this, contents, contents.getLong(0x10));
-					result &= infoSection.populate(*this, contents, contents.getLong(0x18));
-					// Populate INFO Section's brsarInfoFileHeader structs with their respective raw File Contents
-					if (contents.populated() && contents.getLong(getVirtualFILESectionAddress()) == brsarHexTags::bht_FILE)
+				std::vector<unsigned char>* rawData = &contentsIn.data;
+				unsigned long newRawDataLength = rawData->size();
+				if (result && waveSection.entries.size() > remainingWaveCountIn)
+				{
+					// Keep the raw data up to the end of whichever remaining packet reaches furthest.
+					newRawDataLength = 0x00;
+					for (unsigned long i = 0; i < remainingWaveCountIn; i++)
 					{
-						brsarInfoGroupHeader* currHeader = nullptr;
-						brsarInfoGroupEntry* currEntry = nullptr;
-						for (std::size_t i = 0; i < infoSection.groupHeaders.size(); i++)
-						{
-							currHeader = infoSection.groupHeaders[i].get();
-							for (std::size_t u = 0; u < currHeader->entries.size(); u++)
-							{
-								currEntry = &currHeader->entries[u];
-								brsarInfoFileHeader* targetFileHeader = infoSection.getFileHeaderPointer(currEntry->fileID);
-								if (targetFileHeader != nullptr)
-								{
-									targetFileHeader->fileContents.header = contents.getBytes(currEntry->headerLength, currHeader->headerAddress + currEntry->headerOffset);
-									targetFileHeader->fileContents.data = contents.getBytes(currEntry->dataLength, currHeader->dataAddress + currEntry->dataOffset);
-								}
-							}
-						}
+						newRawDataLength = std::max(newRawDataLength, getRWSDWavePacketEnd(waveSection, i, rawData->size()));
 					}
-					// Recalculate the referenced addresses and offsets used in the INFO Section's brsarInfoGroupHeader/Entry structs
-					signalVirtualFILESectionSizeChange();
-					infoSection.updateGroupEntryAddressValues();
+					waveSection.entries.resize(remainingWaveCountIn);
 				}
-			}
-			return result;
-		}
-		bool brsar::exportVirtualFileSection(std::ostream& destinationStream)
-		{
-			unsigned long fileLengthTotal = 0x20;
-			unsigned long preFileDumpStreamPos = destinationStream.tellp();
-			destinationStream.write(std::vector<char>(0x20, 0x00).data(), 0x20);
-			for (int i = 0; i < infoSection.groupHeaders.size(); i++)
-			{
-				brsarInfoGroupHeader* currGroupHeader = infoSection.groupHeaders[i].get();
-				for (int u = 0; u < currGroupHeader->entries.size(); u++)
+
+				if (result && zeroOutRemainingWaves)
 				{
-					brsarInfoGroupEntry* currGroupEntry = &currGroupHeader->entries[u];
-					brsarInfoFileHeader* currFileHeader = infoSection.getFileHeaderPointer(currGroupEntry->fileID);
-					if (currFileHeader != nullptr)
+					for (std::size_t i = 0; i < waveSection.entries.size(); i++)
 					{
-						fileLengthTotal += currFileHeader->fileContents.header.size();
-						destinationStream.write((char*)currFileHeader->fileContents.header.data(), currFileHeader->fileContents.header.size());
+						waveSection.entries[i].hollowOut();
 					}
+					waveSection.updateWaveEntryDataLocations();
 				}
-				for (int u = 0; u < currGroupHeader->entries.size(); u++)
+
+				result = result && rebuildRWSDWaveSection(contentsIn, waveSection);
+				if (result)
 				{
-					brsarInfoGroupEntry* currGroupEntry = &currGroupHeader->entries[u];
-					brsarInfoFileHeader* currFileHeader = infoSection.getFileHeaderPointer(currGroupEntry->fileID);
-					if (currFileHeader != nullptr)
+					if (zeroOutRemainingWaves)
 					{
-						fileLengthTotal += currFileHeader->fileContents.data.size();
-						destinationStream.write((char*)currFileHeader->fileContents.data.data(), currFileHeader->fileContents.data.size());
+						std::stringstream tempStream(std::ios_base::in | std::ios_base::out | std::ios_base::binary);
+						waveSection.exportRawDataSection(tempStream);
+						*rawData = streamContentsToVec(tempStream);
+					}
+					else
+					{
+						rawData->resize(newRawDataLength);
 					}
 				}
 			}
-			destinationStream.seekp(preFileDumpStreamPos);
-			writeRawDataToStream(destinationStream, unsigned long(brsarHexTags::bht_FILE));
-			writeRawDataToStream(destinationStream, fileLengthTotal);
-			destinationStream.write(std::vector<char>(0x18, 0x00).data(), 0x18);
-			return 1;
-		}
-		bool brsar::exportContents(std::ostream& destinationStream)
-		{
-			bool result = 1;
 
-			writeRawDataToStream(destinationStream, brsarHexTags::bht_RSAR);
-			writeRawDataToStream(destinationStream, byteOrderMarker);
-			writeRawDataToStream(destinationStream, version);
-			writeRawDataToStream(destinationStream, size());
-			writeRawDataToStream(destinationStream, headerLength);
-			writeRawDataToStream(destinationStream, sectionCount);
-			writeRawDataToStream(destinationStream, getSYMBSectionAddress());
-			writeRawDataToStream(destinationStream, symbSection.paddedSize());
-			writeRawDataToStream(destinationStream, getINFOSectionAddress());
-			writeRawDataToStream(destinationStream, infoSection.paddedSize());
-			writeRawDataToStream(destinationStream, getVirtualFILESectionAddress());
-			writeRawDataToStream(destinationStream, getVirtualFILESectionSize());
-			if (headerLength > destinationStream.tellp())
-			{
-				std::vector<char> padding(headerLength - destinationStream.tellp(), 0x00);
-				destinationStream.write(padding.data(), padding.size());
-			}
-			result &= symbSection.exportContents(destinationStream);
-			result &= infoSection.exportContents(destinationStream);
-			result &= exportVirtualFileSection(destinationStream);
-			
 			return result;
 		}
-		bool brsar::exportContents(std::string outputFilename)
+		bool brsar::rwsdAppendWaves(unsigned long fileIDIn, const waveInfo& sourceWaveIn, unsigned long countIn)
 		{
 			bool result = 0;
 
-			std::ofstream output(outputFilename, std::ios_base::out | std::ios_base::binary);
-			if (output.is_open())
+			brsarInfoFileHeader* fileHeaderPtr = beginInPlaceRWSDEdit(fileIDIn);
+			if (fileHeaderPtr != nullptr && rwsdAppendWavesToContents(fileHeaderPtr->fileContents, sourceWaveIn, countIn))
 			{
-				result = exportContents(output);
+				result = finishInPlaceRWSDEdit(fileIDIn);
 			}
 
 			return result;
 		}
-
-		void brsar::signalSYMBSectionSizeChange()
-		{
-			symbSectionCachedSize = ULONG_MAX;
-		}
-		void brsar::signalINFOSectionSizeChange()
-		{
-			infoSectionCachedSize = ULONG_MAX;
-		}
-		void brsar::signalVirtualFILESectionSizeChange()
+		bool brsar::rwsdAppendWaves(unsigned long fileIDIn, unsigned long sourceWaveIndexIn, unsigned long countIn, bool hollowOutNewWaves)
 		{
-			virtualFileSectionCachedSize = ULONG_MAX;
-		}
+			bool result = 0;
 
-		unsigned long brsar::getSYMBSectionSize()
-		{
-			if (symbSectionCachedSize == ULONG_MAX)
-			{
-				symbSectionCachedSize = symbSection.paddedSize();
-			}
-			return symbSectionCachedSize;
-		}
-		unsigned long brsar::getINFOSectionSize()
-		{
-			if (infoSectionCachedSize == ULONG_MAX)
+			brsarInfoFileHeader* fileHeaderPtr = beginInPlaceRWSDEdit(fileIDIn);
+			if (fileHeaderPtr != nullptr && rwsdAppendWavesToContents(fileHeaderPtr->fileContents, sourceWaveIndexIn, countIn, hollowOutNewWaves))
 			{
-				infoSectionCachedSize = infoSection.paddedSize();
+				result = finishInPlaceRWSDEdit(fileIDIn);
 			}
-			return infoSectionCachedSize;
+
+			return result;
 		}
-		unsigned long brsar::getVirtualFILESectionSize()
+		bool brsar::rwsdTruncateWaves(unsigned long fileIDIn, unsigned long remainingWaveCountIn, bool zeroOutRemainingWaves)
 		{
-			if (virtualFileSectionCachedSize == ULONG_MAX)
+			bool result = 0;
+
+			brsarInfoFileHeader* fileHeaderPtr = beginInPlaceRWSDEdit(fileIDIn);
+			if (fileHeaderPtr != nullptr && rwsdTruncateWavesInContents(fileHeaderPtr->fileContents, remainingWaveCountIn, zeroOutRemainingWaves))
 			{
-				virtualFileSectionCachedSize = infoSection.virutalFileSectionSize();
+				result = finishInPlaceRWSDEdit(fileIDIn);
 			}
-			return virtualFileSectionCachedSize;
-		}
-
-		unsigned long brsar::getSYMBSectionAddress()
-		{
-			return headerLength;
-		}
-		unsigned long brsar::getINFOSectionAddress()
-		{
-			return headerLength + getSYMBSectionSize();
-		}
-		unsigned long brsar::getVirtualFILESectionAddress()
-		{
-			return headerLength + getSYMBSectionSize() + getINFOSectionSize();
-		}
 
-		std::string brsar::getSymbString(unsigned long indexIn)
-		{
-			return symbSection.getString(indexIn);
+			return result;
 		}
-		unsigned long brsar::getGroupOffset(unsigned long groupIDIn)
+
+		bool brsar::batchProcessFiles(const std::vector<unsigned long>& fileIDsIn, const std::function<bool(unsigned long, brsarFileFileContents&)>& stageFuncIn,
+			unsigned long threadCount, std::vector<char>* succeededOut)
 		{
-			std::size_t result = SIZE_MAX;
+			bool result = 1;
 
-			std::size_t i = 0;
-			bool done = 0;
+			// Drop repeated IDs, so that no two threads ever work on the same file.
+			std::vector<unsigned long> uniqueFileIDs{};
+			std::unordered_map<unsigned long, std::size_t> fileIDsToUniqueIndeces{};
+			for (std::size_t i = 0; i < fileIDsIn.size(); i++)
+			{
+				if (fileIDsToUniqueIndeces.emplace(fileIDsIn[i], uniqueFileIDs.size()).second)
+				{
+					uniqueFileIDs.push_back(fileIDsIn[i]);
+				}
+			}
 
-			const brsarInfoGroupHeader* currentGroup = nullptr;
-			while (!done && i < infoSection.groupHeaders.size())
+			// Write any pending cached edits back first so the stages see them; a file whose edits can't be written back is skipped.
+			std::vector<brsarInfoFileHeader*> fileHeaderPtrs(uniqueFileIDs.size(), nullptr);
+			for (std::size_t i = 0; i < uniqueFileIDs.size(); i++)
 			{
-				currentGroup = infoSection.groupHeaders[i].get();
-				if (groupIDIn == currentGroup->groupID)
+				if (flushRWSDCacheEntry(uniqueFileIDs[i]))
 				{
-					result = currentGroup->getAddress();
-					done = 1;
+					fileHeaderPtrs[i] = infoSection.getFileHeaderPointer(uniqueFileIDs[i]);
 				}
-				else
+			}
+
+			// Each stage works on its own copy of the file's contents, so a failing stage can't leave anything half-applied.
+			std::vector<brsarFileFileContents> stagedContents(uniqueFileIDs.size());
+			std::vector<char> uniqueSucceeded(uniqueFileIDs.size(), 0);
+			lava::parallelFor(uniqueFileIDs.size(), [&](std::size_t i)
+			{
+				if (fileHeaderPtrs[i] != nullptr)
 				{
-					i++;
+					stagedContents[i] = fileHeaderPtrs[i]->fileContents;
+					uniqueSucceeded[i] = stageFuncIn(uniqueFileIDs[i], stagedContents[i]);
+				}
+			}, threadCount);
+			for (std::size_t i = 0; i < uniqueFileIDs.size(); i++)
+			{
+				result &= uniqueSucceeded[i] != 0;
+			}
+
+			// Commit the results in order, and only if every stage succeeded; otherwise the BRSAR is left as it was.
+			if (result && !uniqueFileIDs.empty())
+			{
+				for (std::size_t i = 0; i < uniqueFileIDs.size(); i++)
+				{
+					// The cached parse goes stale once the new contents are in.
+					dropRWSDCacheEntry(uniqueFileIDs[i]);
+					fileHeaderPtrs[i]->fileContents = std::move(stagedContents[i]);
+					refreshWaveReferrerIndex(uniqueFileIDs[i]);
+				}
+				result = infoSection.updateGroupEntryAddressValues();
+				signalVirtualFILESectionSizeChange();
+			}
+
+			if (succeededOut != nullptr)
+			{
+				succeededOut->resize(fileIDsIn.size());
+				for (std::size_t i = 0; i < fileIDsIn.size(); i++)
+				{
+					(*succeededOut)[i] = uniqueSucceeded[fileIDsToUniqueIndeces[fileIDsIn[i]]];
 				}
 			}
 
 			return result;
 		}
-
-		bool brsar::overwriteFile(const std::vector<unsigned char>& headerIn, const std::vector<unsigned char>& dataIn, unsigned long fileIDIn)
+		bool brsar::batchEditRWSDs(const std::vector<unsigned long>& fileIDsIn, const std::function<bool(unsigned long, rwsd&)>& editFuncIn,
+			unsigned long threadCount, std::vector<char>* succeededOut)
 		{
-			bool result = 0;
+			return batchProcessFiles(fileIDsIn, [&editFuncIn](unsigned long fileIDIn, brsarFileFileContents& contentsIn)
+			{
+				bool result = 0;
 
-			brsarInfoFileHeader* fileHeaderPtr = infoSection.getFileHeaderPointer(fileIDIn);
-			if (fileHeaderPtr != nullptr)
+				rwsd tempRWSD;
+				if (tempRWSD.populate(contentsIn) && editFuncIn(fileIDIn, tempRWSD))
+				{
+					std::vector<unsigned char> newHeader = tempRWSD.fileSectionToVec();
+					if (!newHeader.empty())
+					{
+						contentsIn.header = std::move(newHeader);
+						contentsIn.data = tempRWSD.rawDataSectionToVec();
+						result = 1;
+					}
+				}
+
+				return result;
+			}, threadCount, succeededOut);
+		}
+		bool brsar::batchEditRBNKs(const std::vector<unsigned long>& fileIDsIn, const std::function<bool(unsigned long, rbnk&)>& editFuncIn,
+			unsigned long threadCount, std::vector<char>* succeededOut)
+		{
+			return batchProcessFiles(fileIDsIn, [&editFuncIn](unsigned long fileIDIn, brsarFileFileContents& contentsIn)
 			{
-				result = 1;
-				// Replace File Contents
-				fileHeaderPtr->fileContents.header = headerIn;
-				fileHeaderPtr->fileContents.data = dataIn;
-				// Update the rest of the infoSection to correct the changes to file locations
-				result &= infoSection.updateGroupEntryAddressValues();
-				signalVirtualFILESectionSizeChange();
-			}
+				bool result = 0;
 
-			return result;
+				rbnk tempRBNK;
+				if (tempRBNK.populate(contentsIn) && editFuncIn(fileIDIn, tempRBNK))
+				{
+					std::vector<unsigned char> newHeader = tempRBNK.fileSectionToVec();
+					if (!newHeader.empty())
+					{
+						contentsIn.header = std::move(newHeader);
+						contentsIn.data = tempRBNK.rawDataSectionToVec();
+						result = 1;
+					}
+				}
+
+				return result;
+			}, threadCount, succeededOut);
+		}
+		bool brsar::batchAppendWaves(const std::vector<unsigned long>& fileIDsIn, unsigned long sourceWaveIndexIn, unsigned long countIn, bool hollowOutNewWaves,
+			unsigned long threadCount, std::vector<char>* succeededOut)
+		{
+			return batchProcessFiles(fileIDsIn, [=](unsigned long, brsarFileFileContents& contentsIn)
+			{
+				return rwsdAppendWavesToContents(contentsIn, sourceWaveIndexIn, countIn, hollowOutNewWaves);
+			}, threadCount, succeededOut);
+		}
+		bool brsar::batchTruncateWaves(const std::vector<unsigned long>& fileIDsIn, unsigned long remainingWaveCountIn, bool zeroOutRemainingWaves,
+			unsigned long threadCount, std::vector<char>* succeededOut)
+		{
+			return batchProcessFiles(fileIDsIn, [=](unsigned long, brsarFileFileContents& contentsIn)
+			{
+				return rwsdTruncateWavesInContents(contentsIn, remainingWaveCountIn, zeroOutRemainingWaves);
+			}, threadCount, succeededOut);
 		}
+
 		bool brsar::cloneFile(unsigned long fileIDToClone, unsigned long groupToLink)
 		{
 			bool result = 0;
 
+			// Make sure any pending edits to the source file are included in the clone.
+			flushRWSDCacheEntry(fileIDToClone);
 			brsarInfoFileHeader* targetFileHeader = infoSection.getFileHeaderPointer(fileIDToClone);
 			if (targetFileHeader != nullptr)
 			{
@@ -3763,6 +8654,13 @@ namespace lava
 						signalVirtualFILESectionSizeChange();
 						infoSection.updateChildStructOffsetValues(brsarInfoSection::infoSectionLandmark::iSL_FileHeaders);
 						infoSection.updateGroupEntryAddressValues();
+						// No Sound Entries point at the clone yet, but give it its own (empty) entry in the wave referrer index
+						// so that it's tracked alongside the file it was cloned from.
+						if (waveReferrerIndexBuilt && fileIDsToWaveSoundIDs.find(fileIDToClone) != fileIDsToWaveSoundIDs.end())
+						{
+							fileIDsToWaveSoundIDs.emplace(newFileID, std::vector<unsigned long>());
+							refreshWaveReferrerIndex(newFileID);
+						}
 					}
 				}
 			}
@@ -3796,6 +8694,7 @@ namespace lava
 		{
 			bool result = 0;
 
+			flushRWSDCache();
 			std::filesystem::create_directories(dumpRootFolder);
 			brsarInfoGroupHeader* currHeader = nullptr;
 			brsarInfoGroupEntry* currEntry = nullptr;
@@ -3988,5 +8887,352 @@ namespace lava
 		}
 
 		/* BRSAR */
+
+
+
+		/* BRSAR Sound Catalog */
+
+		bool brsarSoundCatalogEntry::populate(const lava::byteArray& bodyIn, std::size_t addressIn, std::size_t* nextAddressOut)
+		{
+			bool result = 0;
+
+			// Sound ID, Sound Type, File ID, Data/Wave Index, Sample Rate, Length, Byte Size and Group Count
+			const std::size_t fixedFieldsLength = (sizeof(unsigned long) * 8) + sizeof(unsigned char);
+			if (bodyIn.populated() && (addressIn + fixedFieldsLength) <= bodyIn.size())
+			{
+				std::size_t cursor = addressIn;
+				soundID = bodyIn.getLong(cursor, &cursor);
+				soundType = bodyIn.getChar(cursor, &cursor);
+				fileID = bodyIn.getLong(cursor, &cursor);
+				dataIndex = bodyIn.getLong(cursor, &cursor);
+				waveIndex = bodyIn.getLong(cursor, &cursor);
+				sampleRate = bodyIn.getLong(cursor, &cursor);
+				lengthInSamples = bodyIn.getLong(cursor, &cursor);
+				byteSize = bodyIn.getLong(cursor, &cursor);
+				unsigned long groupCount = bodyIn.getLong(cursor, &cursor);
+				if ((cursor + (groupCount * sizeof(unsigned long)) + sizeof(unsigned long)) <= bodyIn.size())
+				{
+					groupIDs.resize(groupCount);
+					for (std::size_t i = 0; i < groupCount; i++)
+					{
+						groupIDs[i] = bodyIn.getLong(cursor, &cursor);
+					}
+					unsigned long nameLength = bodyIn.getLong(cursor, &cursor);
+					if ((cursor + nameLength) <= bodyIn.size())
+					{
+						std::vector<unsigned char> nameBytes = bodyIn.getBytes(nameLength, cursor, &cursor);
+						name = std::string(nameBytes.begin(), nameBytes.end());
+						if (nextAddressOut != nullptr)
+						{
+							*nextAddressOut = cursor;
+						}
+						result = 1;
+					}
+				}
+			}
+
+			return result;
+		}
+		bool brsarSoundCatalogEntry::exportContents(std::ostream& destinationStream) const
+		{
+			bool result = 0;
+			if (destinationStream.good())
+			{
+				lava::writeRawDataToStream(destinationStream, soundID);
+				lava::writeRawDataToStream(destinationStream, soundType);
+				lava::writeRawDataToStream(destinationStream, fileID);
+				lava::writeRawDataToStream(destinationStream, dataIndex);
+				lava::writeRawDataToStream(destinationStream, waveIndex);
+				lava::writeRawDataToStream(destinationStream, sampleRate);
+				lava::writeRawDataToStream(destinationStream, lengthInSamples);
+				lava::writeRawDataToStream(destinationStream, byteSize);
+				lava::writeRawDataToStream(destinationStream, unsigned long(groupIDs.size()));
+				for (std::size_t i = 0; i < groupIDs.size(); i++)
+				{
+					lava::writeRawDataToStream(destinationStream, groupIDs[i]);
+				}
+				lava::writeRawDataToStream(destinationStream, unsigned long(name.size()));
+				destinationStream.write(name.data(), name.size());
+
+				result = destinationStream.good();
+			}
+			return result;
+		}
+
+		std::array<unsigned char, MD5::HashBytes> brsarSoundCatalog::calculateSourceHash(brsar& sourceBrsarIn)
+		{
+			std::array<unsigned char, MD5::HashBytes> result{};
+
+			// Pending cached RWSD edits haven't reached the file contents yet, so write them back before hashing anything.
+			sourceBrsarIn.flushRWSDCache();
+			MD5 md5Object;
+			std::stringstream tempStream(std::ios_base::in | std::ios_base::out | std::ios_base::binary);
+			sourceBrsarIn.symbSection.exportContents(tempStream);
+			sourceBrsarIn.infoSection.exportContents(tempStream);
+			std::vector<unsigned char> sectionBytes = streamContentsToVec(tempStream);
+			md5Object.add(sectionBytes.data(), sectionBytes.size());
+			// Wave indeces, sample rates and lengths come from the RWSDs themselves, all of which live in their headers.
+			for (std::size_t i = 0; i < sourceBrsarIn.infoSection.fileHeaders.size(); i++)
+			{
+				const brsarFileFileContents* currContents = &sourceBrsarIn.infoSection.fileHeaders[i]->fileContents;
+				if (currContents->getFileType() == brsarHexTags::bht_RWSD)
+				{
+					md5Object.add(currContents->header.data(), currContents->header.size());
+				}
+			}
+			md5Object.getHash(result.data());
+
+			return result;
+		}
+		bool brsarSoundCatalog::build(brsar& sourceBrsarIn, unsigned long threadCount)
+		{
+			bool result = 0;
+
+			entries.clear();
+			namesToSoundIDs.clear();
+			sourceHash.fill(0x00);
+
+			brsarInfoSection* infoSectionPtr = &sourceBrsarIn.infoSection;
+			if (infoSectionPtr->address != ULONG_MAX)
+			{
+				result = 1;
+				sourceHash = calculateSourceHash(sourceBrsarIn);
+				entries.resize(infoSectionPtr->soundEntries.size());
+
+				// Join SYMB and INFO data, and bucket Wave Sounds by the RWSD they live in.
+				std::unordered_map<unsigned long, std::vector<unsigned long>> fileIDsToWaveSoundIDs{};
+				std::vector<unsigned long> waveFileIDs{};
+				for (std::size_t i = 0; i < infoSectionPtr->soundEntries.size(); i++)
+				{
+					const brsarInfoSoundEntry* currSoundEntry = infoSectionPtr->soundEntries[i].get();
+					brsarSoundCatalogEntry* currCatalogEntry = &entries[i];
+					currCatalogEntry->soundID = i;
+					currCatalogEntry->name = sourceBrsarIn.getSymbString(currSoundEntry->stringID);
+					currCatalogEntry->soundType = currSoundEntry->soundType;
+					currCatalogEntry->fileID = currSoundEntry->fileID;
+					auto groupListItr = infoSectionPtr->fileIDsToGroupInfoIndecesThatUseThem.find(currSoundEntry->fileID);
+					if (groupListItr != infoSectionPtr->fileIDsToGroupInfoIndecesThatUseThem.end())
+					{
+						currCatalogEntry->groupIDs.assign(groupListItr->second.begin(), groupListItr->second.end());
+					}
+					if (currSoundEntry->soundType == soundInfoTypes::sit_WAVE)
+					{
+						currCatalogEntry->dataIndex = currSoundEntry->waveSoundInfo.soundIndex;
+						auto emplaceResult = fileIDsToWaveSoundIDs.emplace(currSoundEntry->fileID, std::vector<unsigned long>());
+						if (emplaceResult.second)
+						{
+							waveFileIDs.push_back(currSoundEntry->fileID);
+						}
+						emplaceResult.first->second.push_back(i);
+					}
+					else if (currSoundEntry->soundType == soundInfoTypes::sit_SEQUENCE)
+					{
+						brsarInfoFileHeader* fileHeaderPtr = infoSectionPtr->getFileHeaderPointer(currSoundEntry->fileID);
+						if (fileHeaderPtr != nullptr)
+						{
+							currCatalogEntry->byteSize = fileHeaderPtr->fileContents.size();
+						}
+					}
+				}
+
+				// Parse each RWSD once, in parallel. Every Sound ID belongs to exactly one file, so no two threads touch the same entry.
+				lava::parallelFor(waveFileIDs.size(), [&](std::size_t fileIndex)
+				{
+					unsigned long currFileID = waveFileIDs[fileIndex];
+					brsarInfoFileHeader* fileHeaderPtr = infoSectionPtr->getFileHeaderPointer(currFileID);
+					if (fileHeaderPtr != nullptr && fileHeaderPtr->fileContents.getFileType() == brsarHexTags::bht_RWSD)
+					{
+						// Only the wave indeces are needed from the DATA section and the format of each wave from the WAVE section,
+						// so read them straight out of the header rather than copying and decoding it.
+						const std::vector<unsigned char>* header = &fileHeaderPtr->fileContents.header;
+						unsigned long waveSectionAddress = getFundamentalFromVec<unsigned long>(*header, 0x18);
+						std::vector<dataInfoView> dataEntryViews{};
+						if (rwsd::getDataEntryViews(*header, dataEntryViews))
+						{
+							const std::vector<unsigned long>* soundIDsInFile = &fileIDsToWaveSoundIDs.at(currFileID);
+							for (std::size_t i = 0; i < soundIDsInFile->size(); i++)
+							{
+								brsarSoundCatalogEntry* currCatalogEntry = &entries[(*soundIDsInFile)[i]];
+								if (currCatalogEntry->dataIndex < dataEntryViews.size())
+								{
+									currCatalogEntry->waveIndex = dataEntryViews[currCatalogEntry->dataIndex].getWaveIndex();
+									waveInfo currWave;
+									if (currWave.populateHeader(*header, rwsdWaveSection::getEntryAddress(*header, waveSectionAddress, currCatalogEntry->waveIndex)))
+									{
+										currCatalogEntry->sampleRate = currWave.getSampleRate();
+										currCatalogEntry->lengthInSamples = nibblesToSamples(currWave.nibbles);
+										currCatalogEntry->byteSize = nibblesToBytes(currWave.nibbles) * currWave.channels;
+									}
+								}
+							}
+						}
+					}
+				}, threadCount);
+
+				for (std::size_t i = 0; i < entries.size(); i++)
+				{
+					if (!entries[i].name.empty())
+					{
+						namesToSoundIDs.emplace(entries[i].name, i);
+					}
+				}
+			}
+
+			return result;
+		}
+		bool brsarSoundCatalog::isUpToDate(brsar& sourceBrsarIn) const
+		{
+			return entries.size() == sourceBrsarIn.infoSection.soundEntries.size() && sourceHash == calculateSourceHash(sourceBrsarIn);
+		}
+
+		const brsarSoundCatalogEntry* brsarSoundCatalog::getEntryWithID(unsigned long soundIDIn) const
+		{
+			const brsarSoundCatalogEntry* result = nullptr;
+
+			if (soundIDIn < entries.size())
+			{
+				result = &entries[soundIDIn];
+			}
+
+			return result;
+		}
+		const brsarSoundCatalogEntry* brsarSoundCatalog::getEntryWithName(const std::string& nameIn) const
+		{
+			const brsarSoundCatalogEntry* result = nullptr;
+
+			auto findResult = namesToSoundIDs.find(nameIn);
+			if (findResult != namesToSoundIDs.end())
+			{
+				result = getEntryWithID(findResult->second);
+			}
+
+			return result;
+		}
+
+		bool brsarSoundCatalog::populate(std::string filePathIn)
+		{
+			bool result = 0;
+
+			lava::byteArray fileArray(filePathIn);
+			if (fileArray.populated() && fileArray.size() >= 0x1C && fileArray.getLong(0x00) == catalogTag && fileArray.getLong(0x04) == catalogVersion)
+			{
+				result = 1;
+				std::vector<unsigned char> hashBytes = fileArray.getBytes(sourceHash.size(), 0x08);
+				std::copy(hashBytes.begin(), hashBytes.end(), sourceHash.begin());
+				entries.resize(fileArray.getLong(0x18));
+				namesToSoundIDs.clear();
+
+				std::size_t cursor = 0x1C;
+				for (std::size_t i = 0; result && i < entries.size(); i++)
+				{
+					result = entries[i].populate(fileArray, cursor, &cursor);
+					if (result && !entries[i].name.empty())
+					{
+						namesToSoundIDs.emplace(entries[i].name, i);
+					}
+				}
+
+				if (!result)
+				{
+					std::cerr << "Sound catalog \"" << filePathIn << "\" is truncated or corrupt!\n";
+					entries.clear();
+					namesToSoundIDs.clear();
+					sourceHash.fill(0x00);
+				}
+			}
+
+			return result;
+		}
+		bool brsarSoundCatalog::exportContents(std::ostream& destinationStream) const
+		{
+			bool result = 0;
+			if (destinationStream.good())
+			{
+				result = 1;
+				lava::writeRawDataToStream(destinationStream, catalogTag);
+				lava::writeRawDataToStream(destinationStream, catalogVersion);
+				destinationStream.write((const char*)sourceHash.data(), sourceHash.size());
+				lava::writeRawDataToStream(destinationStream, unsigned long(entries.size()));
+				for (std::size_t i = 0; result && i < entries.size(); i++)
+				{
+					result &= entries[i].exportContents(destinationStream);
+				}
+				result &= destinationStream.good();
+			}
+			return result;
+		}
+		bool brsarSoundCatalog::exportContents(std::string outputFilename) const
+		{
+			bool result = 0;
+
+			std::ofstream output(outputFilename, std::ios_base::out | std::ios_base::binary);
+			if (output.is_open())
+			{
+				result = exportContents(output);
+			}
+
+			return result;
+		}
+		bool brsarSoundCatalog::summarize(std::ostream& output) const
+		{
+			bool result = 0;
+
+			if (output.good())
+			{
+				output << "Sound Catalog Summary - lavaBRSARLib " << version << "\n";
+				output << "Sound Count: " << entries.size() << "\n\n";
+				for (std::size_t i = 0; i < entries.size(); i++)
+				{
+					const brsarSoundCatalogEntry* currEntry = &entries[i];
+					output << "Sound 0x" << numToHexStringWithPadding(currEntry->soundID, 0x04) << " \"" << currEntry->name << "\"\n";
+					output << "\tType: ";
+					switch (currEntry->soundType)
+					{
+						case soundInfoTypes::sit_SEQUENCE:
+						{
+							output << "Sequence";
+							break;
+						}
+						case soundInfoTypes::sit_STREAM:
+						{
+							output << "Stream";
+							break;
+						}
+						case soundInfoTypes::sit_WAVE:
+						{
+							output << "Wave";
+							break;
+						}
+						default:
+						{
+							output << "Unknown (0x" << numToHexStringWithPadding(currEntry->soundType, 0x02) << ")";
+							break;
+						}
+					}
+					output << "\n\tFile ID: 0x" << numToHexStringWithPadding(currEntry->fileID, 0x04) << "\n";
+					output << "\tGroup ID(s):";
+					for (std::size_t u = 0; u < currEntry->groupIDs.size(); u++)
+					{
+						output << " 0x" << numToHexStringWithPadding(currEntry->groupIDs[u], 0x04);
+					}
+					output << "\n";
+					if (currEntry->waveIndex != ULONG_MAX)
+					{
+						output << "\tData / Wave Index: 0x" << numToHexStringWithPadding(currEntry->dataIndex, 0x04) << " / 0x" << numToHexStringWithPadding(currEntry->waveIndex, 0x04) << "\n";
+						output << "\tSample Rate: " << currEntry->sampleRate << "Hz\n";
+						output << "\tLength: " << currEntry->lengthInSamples << " sample(s)\n";
+					}
+					if (currEntry->byteSize != ULONG_MAX)
+					{
+						output << "\tSize: " << currEntry->byteSize << " byte(s)\n";
+					}
+				}
+				result = output.good();
+			}
+
+			return result;
+		}
+
+		/* BRSAR Sound Catalog */
 	}
 }
\ No newline at end of file
@@ -5,6 +5,13 @@
 #include <filesystem>
 #include <sstream>
 #include <array>
+#include <cstdint>
+#include <algorithm>
+#include <list>
+#include <map>
+#include <functional>
+#include <chrono>
+#include <memory>
 #include "lavaDSP.h"
 #include "lavaByteArray.h"
 #include "lavaUtility.h"
@@ -18,7 +25,7 @@ This library is based heavily off of the work of other people. Special thanks to
 - Gota7 and kitlith (RhythmRevolution Documentation)
 - Halley's Comet Software (VGMStream Source & Documentation, along with a varietey of other resources)
 Additionally, this library directly makes use of the following code written by other people:
-- VGAudioCli by Alex Barney (used for conversions between GC-ADPCM .dsp files and standard .wav files)
+- VGAudio by Alex Barney (GC-ADPCM encoding and coefficient calculation are ported from its source)
 - Portable C++ Hashing Library by Stephan Brumme (used to provide md5 hashes in file export summaries)
 */
 
@@ -27,12 +34,6 @@ namespace lava
 	namespace brawl
 	{
 		const std::string version = "v1.2.1";
-		const std::string VGAudioPath = "./VGAudio/";
-		const std::string VGAudioMainExeName = "VGAudioCli.exe";
-		const std::string VGAudioMainExePath = VGAudioPath + VGAudioMainExeName;
-		const std::string VGAudioTempConvFilename = "__tempfile.dsp";
-		std::string generateVGAudioWavToDSPCommand(std::string wavFilePath, std::string outputFilePath);
-		std::string generateVGAudioDSPToWavCommand(std::string dspFilePath, std::string outputFilePath);
 
 		enum brsarHexTags
 		{
@@ -50,6 +51,8 @@ namespace lava
 			bht_SUBF_WAVE = 0x57415645,
 			bht_SUBF_RWAR = 0x52574152,
 			bht_SUBF_LABL = 0x4C41424C,
+			bht_SUBF_TABL = 0x5441424C,
+			bht_RWAV = 0x52574156,
 		};
 		enum brsarHexTagType
 		{
@@ -75,6 +78,7 @@ namespace lava
 		constexpr unsigned long _EMPTY_SOUND_TOTAL_LENGTH = 0x20;
 		constexpr unsigned long _EMPTY_SOUND_SOUND_LENGTH = 0x02;
 		constexpr unsigned long _EMPTY_SOUND_PADDING_LENGTH = _EMPTY_SOUND_TOTAL_LENGTH - _EMPTY_SOUND_SOUND_LENGTH;
+		constexpr unsigned long _WAVE_CHANNEL_DATA_ALIGNMENT = 0x20;
 
 		/* Misc. */
 
@@ -82,6 +86,18 @@ namespace lava
 		bool detectHexTags(const byteArray& bodyIn, unsigned long startingAddress = 0x00);
 		bool adjustOffset(unsigned long relativeBaseOffset, unsigned long& offsetIn, signed long adjustmentAmount, unsigned long startingAddress);
 		int padLengthTo(unsigned long lengthIn, unsigned long padTo, bool allowZeroPaddingLength = 1);
+		// Big-endian reads straight out of a file's contents, for scans which don't need a byteArray copy of them.
+		// As with byteArray, reads running past the end return the type's max value.
+		template<typename objectType>
+		objectType getFundamentalFromVec(const std::vector<unsigned char>& bodyIn, std::size_t addressIn)
+		{
+			objectType result = objectType(ULLONG_MAX);
+			if ((addressIn + sizeof(objectType)) <= bodyIn.size())
+			{
+				result = lava::bytesToFundamental<objectType>(bodyIn.data() + addressIn);
+			}
+			return result;
+		}
 
 		/* Misc. */
 
@@ -131,6 +147,9 @@ namespace lava
 		};
 		struct waveInfo
 		{
+			// Length of the fixed fields, from encoding through reserved.
+			static constexpr unsigned long headerLength = 0x1C;
+
 			unsigned long address = ULONG_MAX;
 
 			unsigned char encoding = UCHAR_MAX;
@@ -153,12 +172,26 @@ namespace lava
 			wavePacket packetContents;
 
 			unsigned long size() const;
+			// Combines sampleRate with the high bits held in sampleRate24.
+			unsigned long getSampleRate() const;
+			// Length of the wave's audio in the packet, covering every channel.
 			unsigned long getAudioLengthInBytes() const;
+			unsigned long getChannelLengthInBytes() const;
+			// Copies a single channel's audio out of the packet. Any part of the channel missing from the packet is zero-filled.
+			bool getChannelData(unsigned long channelIndex, std::vector<unsigned char>& dataOut) const;
+			// Returns a decoder reading the channel directly out of the packet, without copying it. The wave must outlive the decoder,
+			// and mustn't be edited while it's in use. Any part of the channel which runs into the packet's padding is decoded as zeroed bytes.
+			gcADPCMStreamDecoder getChannelDecoder(unsigned long channelIndex, unsigned long checkpointIntervalIn = 0x100) const;
+			// Sets the channel count, and lays the channel table, channel infos, and ADPCM infos out back-to-back after the header.
+			// Channel data is placed every channelDataStrideIn bytes. Existing channel info properties are kept; new channels copy the last one.
+			void setChannelLayout(unsigned char channelCountIn, unsigned long channelDataStrideIn);
 
 			void copyOverWaveInfoProperties(const waveInfo& sourceInfo);
 			void hollowOut();
 
 			bool populate(const lava::byteArray& bodyIn, unsigned long addressIn);
+			// Reads only the fixed fields, up to and including reserved; the channel tables and packet are left empty.
+			bool populateHeader(const std::vector<unsigned char>& bodyIn, std::size_t addressIn);
 			bool exportContents(std::ostream& destinationStream);
 		};
 		struct dataInfo
@@ -214,11 +247,52 @@ namespace lava
 			brawlReference ntRandomizerTableRef = ULLONG_MAX;
 			unsigned long ntReserved = ULONG_MAX;
 
+			static constexpr unsigned long recordLength = 0xA4;
+
 			unsigned long size() const;
+			bool populateWSDInfo(const lava::byteArray& bodyIn, std::size_t addressIn);
+			bool populateTrackTable(const lava::byteArray& bodyIn, std::size_t addressIn);
+			bool populateNoteTable(const lava::byteArray& bodyIn, std::size_t addressIn);
 			bool populate(const lava::byteArray& bodyIn, std::size_t addressIn);
 			bool exportContents(std::ostream& destinationStream) const;
 			void copyOverDataInfoProperties(const dataInfo& sourceInfo);
 		};
+		// Read-only view of a DATA entry's record, read straight out of the file's header storage rather than a copy of it.
+		// The wave index is read directly; each sub-table is decoded on first access and cached, and materialize() produces a full dataInfo for editing.
+		// Nothing is allocated until a sub-table is asked for, so a scan that only reads wave indeces costs a few bytes per entry.
+		// The source vector must outlive the view, and mustn't be edited while it's in use.
+		struct dataInfoView
+		{
+			const std::vector<unsigned char>* source = nullptr;
+			unsigned long address = ULONG_MAX;
+
+		private:
+			enum decodedParts
+			{
+				dp_WSD_INFO = 0x01,
+				dp_TRACK_TABLE = 0x02,
+				dp_NOTE_TABLE = 0x04,
+			};
+			struct decodedRecord
+			{
+				unsigned char partsMask = 0x00;
+				dataInfo info{};
+			};
+			// Shared between copies of a view, so copying one doesn't copy what it's decoded.
+			mutable std::shared_ptr<decodedRecord> decoded{};
+
+			const dataInfo& decodePart(unsigned char partIn) const;
+		public:
+
+			dataInfoView(const std::vector<unsigned char>* sourceIn = nullptr, unsigned long addressIn = ULONG_MAX);
+
+			bool valid() const;
+			unsigned long getWaveIndex() const;
+			const dataInfo& getWSDInfo() const;
+			const dataInfo& getTrackTable() const;
+			const dataInfo& getNoteTable() const;
+			bool materialize(dataInfo& dataInfoOut) const;
+		};
 
 		/*Sound Data Structs*/
 
@@ -247,6 +321,15 @@ namespace lava
 			bool compareCharAndBit(char charIn) const;
 
 			
+		};
+		// Packed copy of a brsarSymbPTrieNode, used only for lookups (fixed at 12 bytes regardless of platform).
+		struct brsarSymbPTrieLookupNode
+		{
+			std::uint16_t posAndBit = UINT16_MAX;
+			std::uint16_t isLeaf = UINT16_MAX;
+			// For branch nodes, these are the lookup indices of the left and right children.
+			// For leaf nodes, the first holds the index of the source node in brsarSymbPTrie::entries.
+			std::uint32_t links[2] = { UINT32_MAX, UINT32_MAX };
 		};
 		struct brsarSymbPTrie
 		{
@@ -255,12 +338,17 @@ namespace lava
 			unsigned long rootID = ULONG_MAX;
 			unsigned long numEntries = ULONG_MAX;
 
+			// Original node records, kept as-is for export.
 			std::vector<brsarSymbPTrieNode> entries{};
+			// Packed nodes in breadth-first order, with the root at index 0.
+			std::vector<brsarSymbPTrieLookupNode> lookupNodes{};
 
 			unsigned long size() const;
 			bool populate(lava::byteArray& bodyIn, unsigned long addressIn);
 			bool exportContents(std::ostream& destinationStream) const;
 
+			// Returns false, leaving lookupNodes empty, if any branch links outside of entries.
+			bool buildLookupTable();
 			brsarSymbPTrieNode findString(std::string stringIn) const;
 
 		};
@@ -295,6 +383,13 @@ namespace lava
 			std::string getString(std::size_t idIn) const;
 			bool dumpTrieStrings(std::ostream& destinationStream, const brsarSymbPTrie& sourceTrie) const;
 			bool dumpStrings(std::ostream& destinationStream) const;
+
+			// Collects the String IDs referenced by a Trie's leaves, in left-to-right traversal order.
+			void getTrieLeafStringIDs(const brsarSymbPTrie& sourceTrie, std::vector<unsigned long>& destinationVec) const;
+			// Rebuilds the String Block, dropping strings nothing references and merging duplicates.
+			// Strings are laid out in Trie traversal order, and every String ID in the Tries and INFO Section
+			// (including Group IDs, which are String IDs) is remapped to match the new layout.
+			bool compactStringBlock(unsigned long* bytesSavedOut = nullptr);
 		};
 
 		/* BRSAR Symb Section */
@@ -642,6 +737,38 @@ namespace lava
 
 		/* BRSAR File Section */
 
+		struct lablEntry
+		{
+			// For RSEQs, an offset into the sequence data. For RWSDs and RBNKs, the index of the labeled DATA entry.
+			unsigned long dataOffset = ULONG_MAX;
+			std::string name = "";
+
+			unsigned long size() const;
+		};
+		struct lablSection
+		{
+			unsigned long address = ULONG_MAX;
+
+			unsigned long originalLength = ULONG_MAX;
+
+			std::vector<lablEntry> entries{};
+			// Maps each name to its index in entries; if a name appears more than once, the first entry wins.
+			// Kept current by populate and the label functions below. Call rebuildNameIndex() after editing entries directly.
+			std::unordered_map<std::string, unsigned long> nameIndex{};
+
+			void rebuildNameIndex();
+			// Returns ULONG_MAX if no label has the given name.
+			unsigned long findLabelIndex(const std::string& nameIn) const;
+			// Fails if a label with the given name already exists.
+			bool addLabel(const std::string& nameIn, unsigned long dataOffsetIn);
+			bool renameLabel(const std::string& oldNameIn, const std::string& newNameIn);
+
+			unsigned long size() const;
+			unsigned long paddedSize(unsigned long padTo = 0x20) const;
+			bool populate(const lava::byteArray& bodyIn, std::size_t addressIn);
+			bool exportContents(std::ostream& destinationStream) const;
+		};
+
 		struct rwsdDataSection
 		{
 			unsigned long address = ULONG_MAX;
@@ -651,6 +778,15 @@ namespace lava
 			brawlReferenceVector entryReferences;
 			std::vector<dataInfo> entries{};
 
+			// Maps each wave index to the DATA entries which use it, in ascending order.
+			// Kept current by the rwsd edit functions; call rebuildWaveReferrerIndex() after editing ntWaveIndex values directly.
+			std::unordered_map<unsigned long, std::vector<unsigned long>> waveIndecesToReferrerDataIndeces{};
+
+			void rebuildWaveReferrerIndex();
+			bool setEntryWaveIndex(unsigned long dataSectionIndex, unsigned long waveIndexIn);
+			unsigned long getWaveReferenceCount(unsigned long waveIndexIn) const;
+			const std::vector<unsigned long>* getWaveReferrers(unsigned long waveIndexIn) const;
+
 			bool hasExclusiveWave(unsigned long dataSectionIndex);
 			bool isFirstToUseWave(unsigned long dataSectionIndex);
 
@@ -658,6 +794,8 @@ namespace lava
 			unsigned long paddedSize(unsigned long padTo = 0x20) const;
 
 			bool populate(const lava::byteArray& bodyIn, std::size_t address);
+			// Builds a view of every DATA entry without decoding any of them. Invalid entries get views with no source.
+			static bool populateEntryViews(const std::vector<unsigned char>& bodyIn, std::size_t addressIn, std::vector<dataInfoView>& viewsOut);
 			bool exportContents(std::ostream& destinationStream);
 		};
 		struct rwsdWaveSection
@@ -665,17 +803,50 @@ namespace lava
 			unsigned long address = ULONG_MAX;
 
 			unsigned long originalLength = ULONG_MAX;
+			// Set when entries are listed with references (relative to the section body) rather than plain offsets, as RBNKs do.
+			bool referenceTable = 0;
 			
 			std::vector<waveInfo> entries{};
 
 			void waveEntryPushBack(const waveInfo& sourceWave);
 			void waveEntryPushFront(const waveInfo& sourceWave);
+			void waveEntriesPushBack(const waveInfo& sourceWave, unsigned long count);
+			void waveEntriesPushFront(const waveInfo& sourceWave, unsigned long count);
 
 			unsigned long size() const;
+			unsigned long getEntryTableEntryLength() const;
 			std::vector<unsigned long> calculateOffsetVector() const;
 			unsigned long paddedSize(unsigned long padTo = 0x20) const;
 			bool populate(const lava::byteArray& bodyIn, std::size_t addressIn);
+			// Finds an entry in an unparsed WAVE section without copying it. Returns ULONG_MAX if there's no such entry.
+			static unsigned long getEntryAddress(const std::vector<unsigned char>& bodyIn, std::size_t addressIn, unsigned long entryIndexIn);
 			bool exportContents(std::ostream& destinationStream);
+
+			// Wave Packet Funcs, shared by every file type which stores waves in a WAVE section
+
+			bool populateWavePacket(const lava::byteArray& bodyIn, unsigned long waveIndex, unsigned long specificDataAddressIn, unsigned long specificDataMaxLengthIn);
+			bool populateWavePackets(const lava::byteArray& bodyIn, unsigned long waveDataAddressIn, unsigned long waveDataLengthIn);
+			bool updateWaveEntryDataLocations();
+			bool exportRawDataSection(std::ostream& destinationStream) const;
+			dsp exportWaveRawDataToDSP(unsigned long waveSectionIndex, unsigned long channelIndex = 0) const;
+			bool exportWaveRawDataToDSPs(unsigned long waveSectionIndex, std::vector<dsp>& dspsOut, unsigned long threadCount = 0) const;
+			bool exportWaveRawDataToDSPFiles(unsigned long waveSectionIndex, std::string outputPathBase, unsigned long threadCount = 0) const;
+			bool exportWaveRawDataToWAV(unsigned long waveSectionIndex, wav& wavOut, unsigned long threadCount = 0) const;
+			bool exportWaveRawDataToWAV(unsigned long waveSectionIndex, std::string wavOutputPath, unsigned long threadCount = 0) const;
+			bool overwriteWaveRawData(unsigned long waveSectionIndex, const std::vector<unsigned char>& rawDataIn);
+			bool overwriteWaveRawDataWithDSP(unsigned long waveSectionIndex, const dsp& dspIn);
+			bool overwriteWaveRawDataWithDSP(unsigned long waveSectionIndex, std::string dspPathIn);
+			bool overwriteWaveRawDataWithDSPs(unsigned long waveSectionIndex, const std::vector<dsp>& dspsIn);
+			bool overwriteWaveRawDataWithDSPs(unsigned long waveSectionIndex, const std::vector<std::string>& dspPathsIn);
+			bool overwriteWaveRawDataWithWAV(unsigned long waveSectionIndex, const wav& wavIn, unsigned long threadCount = 0, unsigned char encodeModeIn = gcADPCMEncodeModes::gaem_COMPATIBLE,
+				unsigned long targetSampleRateIn = 0, std::vector<gcADPCMEncodeReport>* reportsOut = nullptr);
+			bool overwriteWaveRawDataWithWAV(unsigned long waveSectionIndex, std::string wavPathIn, unsigned long threadCount = 0, unsigned char encodeModeIn = gcADPCMEncodeModes::gaem_COMPATIBLE,
+				unsigned long targetSampleRateIn = 0, std::vector<gcADPCMEncodeReport>* reportsOut = nullptr);
+			// Imports each WAV over its paired wave index. The WAVs are read, resampled, and encoded in parallel, then spliced in order.
+			// succeededOut receives each pair's result, and reportsOut each pair's per-channel encode reports (empty if it failed).
+			bool overwriteWaveRawDataWithWAVs(const std::vector<std::pair<unsigned long, std::string>>& waveIndicesToWAVPathsIn, unsigned long threadCount = 0,
+				unsigned char encodeModeIn = gcADPCMEncodeModes::gaem_COMPATIBLE, unsigned long targetSampleRateIn = 0, std::vector<char>* succeededOut = nullptr,
+				std::vector<std::vector<gcADPCMEncodeReport>>* reportsOut = nullptr);
 		};
 
 		/*struct rwsdHeader
@@ -706,6 +877,8 @@ namespace lava
 			unsigned short versionNumber;
 			rwsdDataSection dataSection;
 			rwsdWaveSection waveSection;
+			// Only present in standalone RWSD files; it isn't stored in (or exported to) BRSARs.
+			lablSection labelSection;
 
 		private:
 			unsigned long dataSectionCachedSize = ULONG_MAX;
@@ -727,8 +900,11 @@ namespace lava
 			bool populateWavePacket(const lava::byteArray& bodyIn, unsigned long waveIndex, unsigned long specificDataAddressIn, unsigned long specificDataMaxLengthIn);
 			bool populateWavePackets(const lava::byteArray& bodyIn, unsigned long waveDataAddressIn, unsigned long waveDataLengthIn);
 			bool populate(const byteArray& fileBodyIn, unsigned long fileBodyAddressIn, const byteArray& rawDataIn, unsigned long rawDataAddressIn, unsigned long rawDataLengthIn);
-			bool populate(const brsarFileFileContents& fileContentsIn);
+			bool populate(const brsarFileFileContents& fileContentsIn, bool populateWavePacketsIn = 1);
 			bool populate(std::string filePathIn);
+			static bool getDataEntryViews(const std::vector<unsigned char>& fileBodyIn, std::vector<dataInfoView>& viewsOut);
+			// Returns ULONG_MAX if there's no such label, or if no LABL section was loaded.
+			unsigned long getDataEntryIndex(const std::string& labelNameIn) const;
 
 			// Export Funcs
 
@@ -736,8 +912,14 @@ namespace lava
 			bool exportRawDataSection(std::ostream& destinationStream);
 			std::vector<unsigned char> fileSectionToVec();
 			std::vector<unsigned char> rawDataSectionToVec();
-			dsp exportWaveRawDataToDSP(unsigned long waveSectionIndex);
-			bool exportWaveRawDataToWAV(unsigned long waveSectionIndex, std::string wavOutputPath);
+			dsp exportWaveRawDataToDSP(unsigned long waveSectionIndex, unsigned long channelIndex = 0);
+			// Exports one DSP per channel, with channels converted in parallel.
+			bool exportWaveRawDataToDSPs(unsigned long waveSectionIndex, std::vector<dsp>& dspsOut, unsigned long threadCount = 0);
+			// Writes "{outputPathBase}.dsp" for mono waves, or "{outputPathBase}_ch{N}.dsp" for each channel otherwise.
+			bool exportWaveRawDataToDSPFiles(unsigned long waveSectionIndex, std::string outputPathBase, unsigned long threadCount = 0);
+			// Multi-channel waves are written as a single interleaved WAV.
+			bool exportWaveRawDataToWAV(unsigned long waveSectionIndex, wav& wavOut, unsigned long threadCount = 0);
+			bool exportWaveRawDataToWAV(unsigned long waveSectionIndex, std::string wavOutputPath, unsigned long threadCount = 0);
 
 			// Utility + Maintenance Funcs
 
@@ -756,14 +938,411 @@ namespace lava
 			bool overwriteWaveRawData(unsigned long waveSectionIndex, const std::vector<unsigned char>& rawDataIn);
 			bool overwriteWaveRawDataWithDSP(unsigned long waveSectionIndex, const dsp& dspIn);
 			bool overwriteWaveRawDataWithDSP(unsigned long waveSectionIndex, std::string dspPathIn);
-			bool overwriteWaveRawDataWithWAV(unsigned long waveSectionIndex, std::string wavPathIn);
+			// Each DSP provides one channel; all of them must agree on sample rate, length, and loop points.
+			bool overwriteWaveRawDataWithDSPs(unsigned long waveSectionIndex, const std::vector<dsp>& dspsIn);
+			bool overwriteWaveRawDataWithDSPs(unsigned long waveSectionIndex, const std::vector<std::string>& dspPathsIn);
+			// Every channel in the source WAV is kept, and channels are encoded in parallel.
+			bool overwriteWaveRawDataWithWAV(unsigned long waveSectionIndex, const wav& wavIn, unsigned long threadCount = 0, unsigned char encodeModeIn = gcADPCMEncodeModes::gaem_COMPATIBLE,
+				unsigned long targetSampleRateIn = 0, std::vector<gcADPCMEncodeReport>* reportsOut = nullptr);
+			bool overwriteWaveRawDataWithWAV(unsigned long waveSectionIndex, std::string wavPathIn, unsigned long threadCount = 0, unsigned char encodeModeIn = gcADPCMEncodeModes::gaem_COMPATIBLE,
+				unsigned long targetSampleRateIn = 0, std::vector<gcADPCMEncodeReport>* reportsOut = nullptr);
+			bool overwriteWaveRawDataWithWAVs(const std::vector<std::pair<unsigned long, std::string>>& waveIndicesToWAVPathsIn, unsigned long threadCount = 0,
+				unsigned char encodeModeIn = gcADPCMEncodeModes::gaem_COMPATIBLE, unsigned long targetSampleRateIn = 0, std::vector<char>* succeededOut = nullptr,
+				std::vector<std::vector<gcADPCMEncodeReport>>* reportsOut = nullptr);
 
 			bool createNewWaveEntry(const waveInfo& sourceWave, bool pushFront = 0);
-			bool createNewWaveEntries(const waveInfo sourceWave, unsigned char cloneCount, bool pushFront = 0);
+			bool createNewWaveEntries(const waveInfo sourceWave, unsigned long cloneCount, bool pushFront = 0);
 			bool grantDataEntryUniqueWave(unsigned long dataSectionIndex, const waveInfo& sourceWave, bool pushFront = 0);
 
 			bool hollowOutWAVEEntry(unsigned long waveID);
 			bool cutDownWaveSection(unsigned long remainingWaveCount = 1, bool zeroOutWaveContent = 1);
+			// Removes every wave which no DATA entry references, and renumbers the remaining references to match.
+			// At least one wave is always kept. If provided, removedWaveCountOut and bytesReclaimedOut receive the savings.
+			bool removeUnreferencedWaves(unsigned long* removedWaveCountOut = nullptr, unsigned long* bytesReclaimedOut = nullptr);
+			// Finds waves whose audio data and playback info (including ADPCM info) are identical, points every DATA entry
+			// using a duplicate at the first copy, and drops the duplicates. With dryRun set, nothing is changed, and
+			// bytesReclaimedOut receives an estimate of the savings instead.
+			bool mergeDuplicateWaves(unsigned long* mergedWaveCountOut = nullptr, unsigned long* bytesReclaimedOut = nullptr, bool dryRun = 0);
+		private:
+			// waveRedirectsIn maps each wave index to the index of the wave its users should use instead.
+			// Waves redirected elsewhere (or set to ULONG_MAX) are removed.
+			bool removeRedirectedWaves(const std::vector<unsigned long>& waveRedirectsIn, unsigned long* removedWaveCountOut, unsigned long* bytesReclaimedOut);
+		};
+
+		enum rbnkRegionTypes
+		{
+			rrt_INVALID = 0x00,
+			rrt_INST_PARAM,
+			rrt_RANGE_TABLE,
+			rrt_INDEX_TABLE,
+			rrt_NULL,
+		};
+		struct rbnkInstParam
+		{
+			unsigned long waveIndex = ULONG_MAX;
+			unsigned char attack = UCHAR_MAX;
+			unsigned char decay = UCHAR_MAX;
+			unsigned char sustain = UCHAR_MAX;
+			unsigned char release = UCHAR_MAX;
+			unsigned char hold = UCHAR_MAX;
+			unsigned char waveDataLocationType = UCHAR_MAX; // Whether waveIndex refers to a wave in the bank's RWAR, or to a separate wave file
+			unsigned char noteOffType = UCHAR_MAX; // Whether a note-off releases the note, or is ignored
+			unsigned char alternateAssign = UCHAR_MAX; // Notes sharing a non-zero group cut each other off
+			unsigned char originalKey = UCHAR_MAX;
+			unsigned char volume = UCHAR_MAX;
+			unsigned char pan = UCHAR_MAX;
+			unsigned char surroundPan = UCHAR_MAX;
+			float pitch = FLT_MAX;
+			brawlReference lfoTableRef = ULLONG_MAX;
+			brawlReference graphEnvTableRef = ULLONG_MAX;
+			brawlReference randomizerTableRef = ULLONG_MAX;
+			unsigned long reserved = ULONG_MAX;
+
+			static constexpr unsigned long size()
+			{
+				return 0x30;
+			}
+			// True if any of the LFO, envelope or randomizer references are set. The tables they point to aren't parsed,
+			// so they can't be relocated when the DATA section is rebuilt.
+			bool referencesTables() const;
+			bool populate(const lava::byteArray& bodyIn, std::size_t addressIn);
+			bool exportContents(std::ostream& destinationStream) const;
+		};
+		struct rbnkRegionRef
+		{
+			// The offset flag, region type, and padding, exactly as stored.
+			unsigned long addressType = 0x00;
+			// Only written back as-is for references which don't point to a node.
+			unsigned long address = 0x00;
+			// Index into the owning rbnkDataSection's node pool, or ULONG_MAX if there's no node.
+			unsigned long nodeIndex = ULONG_MAX;
+
+			unsigned char getRegionType() const;
+		};
+		struct rbnkRegionNode
+		{
+			unsigned long address = ULONG_MAX;
+			unsigned char regionType = rrt_INVALID;
+
+			// Range Tables: each child covers every key (or velocity) up to and including its entry in rangeKeys.
+			std::vector<unsigned char> rangeKeys{};
+			// Index Tables: children cover indexMin through indexMax, one each.
+			unsigned char indexMin = 0x00;
+			unsigned char indexMax = 0x00;
+			unsigned short indexReserved = 0x00;
+			std::vector<rbnkRegionRef> children{};
+			// Instrument Parameters
+			rbnkInstParam instParam{};
+
+			unsigned long size() const;
+			bool exportContents(std::ostream& destinationStream, const std::vector<unsigned long>& nodeOffsetsIn) const;
+		};
+		struct rbnkDataSection
+		{
+			unsigned long address = ULONG_MAX;
+
+			unsigned long originalLength = ULONG_MAX;
+
+			// One reference per instrument (program number).
+			std::vector<rbnkRegionRef> instruments{};
+			// Every table and parameter block in the section, in file order. Shared nodes are only stored once.
+			std::vector<rbnkRegionNode> nodes{};
+
+			unsigned long size() const;
+			unsigned long paddedSize(unsigned long padTo = 0x20) const;
+			// Offsets are relative to the start of the section's body, as references expect.
+			std::vector<unsigned long> calculateNodeOffsetVector() const;
+
+			// Walks from an instrument down through its key and velocity regions. Returns nullptr if nothing covers the note.
+			const rbnkInstParam* findInstParam(unsigned long instrumentIndex, unsigned char key, unsigned char velocity) const;
+			unsigned long getWaveReferenceCount(unsigned long waveIndexIn) const;
+
+			bool populate(const lava::byteArray& bodyIn, std::size_t addressIn);
+			// Fails without writing anything if any instrument parameter references a table (see rbnkInstParam::referencesTables()).
+			bool exportContents(std::ostream& destinationStream) const;
+		private:
+			unsigned long populateNode(const lava::byteArray& bodyIn, const brawlReference& referenceIn, std::unordered_map<unsigned long, unsigned long>& addressesToNodeIndeces);
+			void populateRef(const lava::byteArray& bodyIn, const brawlReference& referenceIn, rbnkRegionRef& refOut, std::unordered_map<unsigned long, unsigned long>& addressesToNodeIndeces);
+		};
+		struct rbnk
+		{
+			unsigned long address = ULONG_MAX;
+
+			unsigned short endianType;
+			unsigned short versionNumber;
+			rbnkDataSection dataSection;
+			rwsdWaveSection waveSection;
+			// Names the instruments; as with RWSDs, only standalone files carry one.
+			lablSection labelSection;
+
+		private:
+			unsigned long dataSectionCachedSize = ULONG_MAX;
+			unsigned long waveSectionCachedSize = ULONG_MAX;
+		public:
+
+			// Size + Offset Functions
+
+			unsigned long size();
+			void signalDATASectionSizeChange();
+			void signalWAVESectionSizeChange();
+			unsigned long getDATASectionSize();
+			unsigned long getWAVESectionSize();
+			unsigned long getDATASectionOffset();
+			unsigned long getWAVESectionOffset();
+
+			// Populate Funcs
+
+			bool populate(const byteArray& fileBodyIn, unsigned long fileBodyAddressIn, const byteArray& rawDataIn, unsigned long rawDataAddressIn, unsigned long rawDataLengthIn);
+			bool populate(const brsarFileFileContents& fileContentsIn, bool populateWavePacketsIn = 1);
+			bool populate(std::string filePathIn);
+
+			// Export Funcs
+
+			bool exportFileSection(std::ostream& destinationStream);
+			bool exportRawDataSection(std::ostream& destinationStream);
+			std::vector<unsigned char> fileSectionToVec();
+			std::vector<unsigned char> rawDataSectionToVec();
+			dsp exportWaveRawDataToDSP(unsigned long waveSectionIndex, unsigned long channelIndex = 0);
+			bool exportWaveRawDataToWAV(unsigned long waveSectionIndex, wav& wavOut, unsigned long threadCount = 0);
+			bool exportWaveRawDataToWAV(unsigned long waveSectionIndex, std::string wavOutputPath, unsigned long threadCount = 0);
+
+			// Utility + Maintenance Funcs
+
+			bool summarize(std::ostream& output);
+			bool summarize(std::string filepath);
+
+			// Edit Funcs
+
+			bool overwriteInstParam(unsigned long nodeIndex, const rbnkInstParam& instParamIn);
+			bool overwriteWaveRawDataWithDSP(unsigned long waveSectionIndex, const dsp& dspIn);
+			bool overwriteWaveRawDataWithDSP(unsigned long waveSectionIndex, std::string dspPathIn);
+			bool overwriteWaveRawDataWithDSPs(unsigned long waveSectionIndex, const std::vector<dsp>& dspsIn);
+			bool overwriteWaveRawDataWithWAV(unsigned long waveSectionIndex, const wav& wavIn, unsigned long threadCount = 0, unsigned char encodeModeIn = gcADPCMEncodeModes::gaem_COMPATIBLE,
+				unsigned long targetSampleRateIn = 0, std::vector<gcADPCMEncodeReport>* reportsOut = nullptr);
+			bool overwriteWaveRawDataWithWAV(unsigned long waveSectionIndex, std::string wavPathIn, unsigned long threadCount = 0, unsigned char encodeModeIn = gcADPCMEncodeModes::gaem_COMPATIBLE,
+				unsigned long targetSampleRateIn = 0, std::vector<gcADPCMEncodeReport>* reportsOut = nullptr);
+			bool overwriteWaveRawDataWithWAVs(const std::vector<std::pair<unsigned long, std::string>>& waveIndicesToWAVPathsIn, unsigned long threadCount = 0,
+				unsigned char encodeModeIn = gcADPCMEncodeModes::gaem_COMPATIBLE, unsigned long targetSampleRateIn = 0, std::vector<char>* succeededOut = nullptr,
+				std::vector<std::vector<gcADPCMEncodeReport>>* reportsOut = nullptr);
+		private:
+			bool summarizeRegion(std::ostream& output, const rbnkRegionRef& refIn, const std::vector<unsigned long>& nodeOffsetsIn, unsigned long depth);
+		};
+
+		struct rwarEntry
+		{
+			// Type of the reference to this entry's RWAV, always seems to be an offset.
+			unsigned long referenceType = 0x01000000;
+			// Address of the entry's RWAV, as read from the original file.
+			unsigned long address = ULONG_MAX;
+			std::vector<unsigned char> contents{};
+
+			// Populates a waveInfo from the entry's RWAV INFO section. Its dataLocation is relative to the RWAV's DATA section body.
+			bool getWaveInfo(waveInfo& infoOut) const;
+		};
+		struct rwar
+		{
+			unsigned long address = ULONG_MAX;
+
+			unsigned short endianType = 0xFEFF;
+			unsigned short versionNumber = 0x0100;
+			std::vector<rwarEntry> entries{};
+
+			// Size + Offset Functions
+
+			unsigned long size() const;
+			unsigned long getTABLSectionSize() const;
+			unsigned long getDATASectionSize() const;
+			unsigned long getTABLSectionOffset() const;
+			unsigned long getDATASectionOffset() const;
+			// Offsets are relative to the start of the DATA section.
+			std::vector<unsigned long> calculateEntryOffsetVector() const;
+
+			// Populate Funcs
+
+			bool populate(const byteArray& fileBodyIn, unsigned long fileBodyAddressIn);
+			bool populate(std::string filePathIn);
+
+			// Export Funcs
+
+			bool exportContents(std::ostream& destinationStream) const;
+			bool exportContents(std::string filePathIn) const;
+			std::vector<unsigned char> contentsToVec() const;
+
+			// Utility Funcs
+
+			bool summarize(std::ostream& output) const;
+			bool summarize(std::string filepath) const;
+		};
+
+		enum rseqEventTypes
+		{
+			ret_NOTE = 0x00,
+			ret_WAIT,
+			ret_PROGRAM,
+			ret_OPEN_TRACK,
+			ret_JUMP,
+			ret_CALL,
+			ret_PARAM_U8,
+			ret_PARAM_S16,
+			ret_ALLOC_TRACK,
+			ret_VARIABLE_OP,
+			ret_COMPARE_OP,
+			ret_USER_PROC,
+			ret_LOOP_END,
+			ret_RETURN,
+			ret_FINISH,
+			ret_UNKNOWN,
+		};
+		enum rseqOpcodes
+		{
+			ro_WAIT = 0x80,
+			ro_PROGRAM = 0x81,
+			ro_OPEN_TRACK = 0x88,
+			ro_JUMP = 0x89,
+			ro_CALL = 0x8A,
+			ro_PREFIX_RANDOM = 0xA0,
+			ro_PREFIX_VARIABLE = 0xA1,
+			ro_PREFIX_IF = 0xA2,
+			ro_PREFIX_TIME = 0xA3,
+			ro_PREFIX_TIME_RANDOM = 0xA4,
+			ro_PREFIX_TIME_VARIABLE = 0xA5,
+			ro_EXTENDED = 0xF0,
+			ro_LOOP_END = 0xFC,
+			ro_RETURN = 0xFD,
+			ro_ALLOC_TRACK = 0xFE,
+			ro_FINISH = 0xFF,
+		};
+		enum rseqPrefixFlags
+		{
+			rpf_RANDOM = 0x01,
+			rpf_VARIABLE = 0x02,
+			rpf_IF = 0x04,
+			rpf_TIME = 0x08,
+			rpf_TIME_RANDOM = 0x10,
+			rpf_TIME_VARIABLE = 0x20,
+		};
+		enum rseqArgTypes
+		{
+			rat_U8 = 0x00,
+			rat_S16,
+			rat_VMIDI,
+			rat_RANDOM,
+			rat_VARIABLE,
+		};
+		struct rseqEvent
+		{
+			// Relative to the start of the sequence data.
+			unsigned long offset = ULONG_MAX;
+			// Includes any prefixes.
+			unsigned long length = 0x00;
+			unsigned char type = rseqEventTypes::ret_UNKNOWN;
+			unsigned char opcode = 0x00;
+			unsigned char extendedOpcode = 0x00;
+			unsigned char prefixes = 0x00;
+
+			// Notes: key, velocity, length. Open Track: track, offset. Variable and Compare Ops: variable, value.
+			// Everything else: the command's single argument, if it has one.
+			// With rpf_RANDOM set, the final argument holds the minimum and randomMax the maximum; with rpf_VARIABLE, it holds the variable index.
+			std::array<signed long, 3> args{};
+			unsigned char argCount = 0x00;
+			signed long randomMax = 0x00;
+			// Filled in by the time prefixes, following the same conventions as above.
+			signed long timeArg = 0x00;
+			signed long timeRandomMax = 0x00;
+		};
+		// Decodes sequence events in order, straight from a byte span; nothing is allocated, and the span must outlive the iterator.
+		// Jumps and calls aren't followed, so every command in the span is visited exactly once.
+		struct rseqEventIterator
+		{
+		private:
+			const unsigned char* dataStart = nullptr;
+			std::size_t dataLength = 0x00;
+			std::size_t cursor = 0x00;
+
+			bool readByte(unsigned char& valueOut);
+			bool readArg(unsigned char argTypeIn, signed long& valueOut, signed long& randomMaxOut);
+		public:
+
+			rseqEventIterator(const unsigned char* dataIn = nullptr, std::size_t lengthIn = 0x00, std::size_t startOffsetIn = 0x00);
+
+			bool atEnd() const;
+			std::size_t getOffset() const;
+			void seek(std::size_t offsetIn);
+			// Decodes the event at the cursor and moves past it. Returns false at the end of the span, or if the event is cut off.
+			bool next(rseqEvent& eventOut);
+		};
+		struct rseq
+		{
+			unsigned long address = ULONG_MAX;
+
+			unsigned short endianType = 0xFEFF;
+			unsigned short versionNumber = 0x0100;
+			// Offset from the start of the DATA section to the sequence data.
+			unsigned long sequenceDataOffset = 0x0C;
+			std::vector<unsigned char> sequenceData{};
+			lablSection labelSection;
+
+			// Size + Offset Functions
+
+			unsigned long size() const;
+			unsigned long getDATASectionSize() const;
+			unsigned long getLABLSectionSize() const;
+			unsigned long getDATASectionOffset() const;
+			unsigned long getLABLSectionOffset() const;
+
+			// Populate Funcs
+
+			bool populate(const byteArray& fileBodyIn, unsigned long fileBodyAddressIn);
+			bool populate(const brsarFileFileContents& fileContentsIn);
+			bool populate(std::string filePathIn);
+			// Drops the DATA section's zeroed alignment padding from the end of sequenceData; exportFileSection() pads it back out.
+			void trimTrailingPadding();
+			// Finds the sequence data in an unparsed RSEQ without copying it.
+			static bool getSequenceDataSpan(const std::vector<unsigned char>& fileBodyIn, const unsigned char*& dataOut, std::size_t& lengthOut);
+
+			// Export Funcs
+
+			bool exportFileSection(std::ostream& destinationStream) const;
+			std::vector<unsigned char> fileSectionToVec() const;
+
+			// Utility Funcs
+
+			rseqEventIterator getEventIterator(unsigned long startOffsetIn = 0x00) const;
+			// Returns ULONG_MAX if there's no such label.
+			unsigned long getLabelOffset(const std::string& labelNameIn) const;
+			// Collects every program number set by a fixed (non-random, non-variable) program change, sorted and without duplicates.
+			// Returns false if an event is cut off before the end of the data; programsOut then holds those found up to that point.
+			static bool getProgramsUsed(rseqEventIterator eventsIn, std::vector<unsigned long>& programsOut);
+			bool summarize(std::ostream& output) const;
+			bool summarize(std::string filepath) const;
+
+			// Assembly Funcs
+
+			// Writes the sequence data out as text, one command per line. Branch targets are written as labels, and any bytes
+			// which wouldn't re-encode identically are written as .byte directives, so reassembling the output is always exact.
+			bool disassemble(std::ostream& output) const;
+			bool disassemble(std::string filepath) const;
+			// Rebuilds the sequence data and LABL section from disassembly text in a single pass.
+			// Branches to labels which aren't defined yet are recorded and backpatched once the whole input has been read.
+			bool assemble(std::istream& input);
+			bool assemble(std::string filepath);
+			// Writes an event back out in its canonical form. Returns false for events which can't be encoded (ret_UNKNOWN).
+			static bool encodeEvent(const rseqEvent& eventIn, std::vector<unsigned char>& destinationVec);
+
+			// Label Funcs
+			// These only ever touch the LABL section, so the sequence data doesn't need to be re-laid out.
+
+			bool renameLabel(const std::string& oldNameIn, const std::string& newNameIn);
+			// Adds the label if it doesn't exist yet.
+			bool setLabelOffset(const std::string& labelNameIn, unsigned long offsetIn);
+
+		private:
+			static std::string getMnemonic(const rseqEvent& eventIn);
+			// Fills in the type, opcode and extended opcode for the specified mnemonic.
+			static bool parseMnemonic(const std::string& mnemonicIn, rseqEvent& eventOut);
+			// Whether or not the event's final argument is the one replaced by the random and variable prefixes.
+			static bool takesOverrideArg(unsigned char eventTypeIn);
+			static unsigned char getDefaultLastArgType(unsigned char eventTypeIn);
 		};
 
 		/* BRSAR File Section */
@@ -772,6 +1351,32 @@ namespace lava
 
 		/* BRSAR */
 
+		struct brsarRoundTripResult
+		{
+			unsigned long fileID = ULONG_MAX;
+			unsigned long fileType = ULONG_MAX;
+			unsigned long byteSize = 0x00;
+			// Set if the file is of a type we parse.
+			bool supported = 0;
+			// Set if parsing and re-exporting succeeded.
+			bool parsed = 0;
+			// Offset of the first byte which differs after re-exporting, or ULONG_MAX if the two match.
+			unsigned long firstHeaderMismatch = ULONG_MAX;
+			unsigned long firstDataMismatch = ULONG_MAX;
+
+			bool matches() const;
+		};
+		struct brsarWaveExportStats
+		{
+			unsigned long filesParsed = 0x00;
+			unsigned long filesFailed = 0x00;
+			unsigned long wavesExported = 0x00;
+			unsigned long wavesFailed = 0x00;
+			double secondsElapsed = 0.0;
+
+			double wavesPerSecond() const;
+		};
+
 		struct brsar
 		{
 			unsigned short byteOrderMarker = USHRT_MAX;
@@ -786,13 +1391,54 @@ namespace lava
 			unsigned long symbSectionCachedSize = ULONG_MAX;
 			unsigned long infoSectionCachedSize = ULONG_MAX;
 			unsigned long virtualFileSectionCachedSize = ULONG_MAX;
+
+			// Wave Sound Entry IDs, bucketed by the File ID they belong to.
+			std::unordered_map<unsigned long, std::vector<unsigned long>> fileIDsToWaveSoundIDs{};
+			// Per RWSD File ID, maps each wave index to the IDs of the Sound Entries which play it.
+			std::unordered_map<unsigned long, std::unordered_map<unsigned long, std::vector<unsigned long>>> fileIDsToWaveSoundReferrers{};
+			bool waveReferrerIndexBuilt = 0;
+
+			// Parsed RWSD Cache
+			struct rwsdCacheEntry
+			{
+				unsigned long fileID = ULONG_MAX;
+				std::unique_ptr<rwsd> parsedRWSD{};
+				unsigned long byteSize = 0x00;
+				bool dirty = 0;
+			};
+			// Most recently used entries are kept at the front.
+			std::list<rwsdCacheEntry> rwsdCache{};
+			std::unordered_map<unsigned long, std::list<rwsdCacheEntry>::iterator> fileIDsToRWSDCacheEntries{};
+			unsigned long rwsdCacheByteBudget = 0x4000000;
+			unsigned long rwsdCacheCurrentBytes = 0x00;
+
+			bool replaceFileContents(const std::vector<unsigned char>& headerIn, const std::vector<unsigned char>& dataIn, unsigned long fileIDIn);
+			bool writeBackRWSDCacheEntry(rwsdCacheEntry& entryIn);
+			void evictRWSDCacheEntries();
+
+			// In-Place RWSD Edit Helpers
+			brsarInfoFileHeader* beginInPlaceRWSDEdit(unsigned long fileIDIn);
+			bool finishInPlaceRWSDEdit(unsigned long fileIDIn);
+			static bool getRWSDWaveSection(const brsarFileFileContents& contentsIn, rwsdWaveSection& sectionOut);
+			static unsigned long getRWSDWavePacketEnd(const rwsdWaveSection& sectionIn, unsigned long waveIndexIn, unsigned long rawDataLengthIn);
+			static bool rebuildRWSDWaveSection(brsarFileFileContents& contentsIn, rwsdWaveSection& sectionIn);
+			static bool rwsdAppendWaveEntries(brsarFileFileContents& contentsIn, rwsdWaveSection& sectionIn, const waveInfo& newWaveIn,
+				const std::vector<unsigned char>& newPacketIn, unsigned long countIn);
+			static bool rwsdAppendWavesToContents(brsarFileFileContents& contentsIn, const waveInfo& sourceWaveIn, unsigned long countIn);
+			static bool rwsdAppendWavesToContents(brsarFileFileContents& contentsIn, unsigned long sourceWaveIndexIn, unsigned long countIn, bool hollowOutNewWaves);
+			static bool rwsdTruncateWavesInContents(brsarFileFileContents& contentsIn, unsigned long remainingWaveCountIn, bool zeroOutRemainingWaves);
+
+			static bool getRWSDDataEntryWaveIndeces(const brsarFileFileContents& contentsIn, std::vector<unsigned long>& waveIndecesOut);
+			bool updateWaveReferrerIndex(unsigned long fileIDIn, const std::vector<unsigned long>& dataEntryWaveIndecesIn);
+			bool refreshWaveReferrerIndex(unsigned long fileIDIn);
 		public:
 
 			unsigned long size();
 			bool init(std::string filePathIn);
 			bool exportVirtualFileSection(std::ostream& destinationStream);
-			bool exportContents(std::ostream& destinationStream);
-			bool exportContents(std::string outputFilename);
+			// Setting compactSymbStrings runs compactSymbStringBlock() before writing, so it changes this object too, not just the output.
+			bool exportContents(std::ostream& destinationStream, bool compactSymbStrings = 0);
+			bool exportContents(std::string outputFilename, bool compactSymbStrings = 0);
 
 			void signalSYMBSectionSizeChange();
 			void signalINFOSectionSizeChange();
@@ -807,8 +1453,77 @@ namespace lava
 			unsigned long getVirtualFILESectionAddress();
 
 			std::string getSymbString(unsigned long indexIn);
+			// Drops unreferenced and duplicate strings, renumbering the string IDs held by the tries and INFO entries.
+			// IDs read out before compacting no longer refer to the same strings afterwards.
+			bool compactSymbStringBlock(unsigned long* bytesSavedOut = nullptr);
 			unsigned long getGroupOffset(unsigned long groupIDIn);
 
+			bool buildWaveReferrerIndex(unsigned long threadCount = 0);
+			bool updateWaveReferrerIndex(unsigned long fileIDIn, const rwsd& rwsdIn);
+			const std::vector<unsigned long>* getSoundIDsUsingWave(unsigned long fileIDIn, unsigned long waveIndexIn) const;
+
+			// Returns a parsed copy of the specified RWSD, parsing it only if it isn't already cached. Not thread-safe.
+			// If forEditing is set, the RWSD is written back into the BRSAR when flushed, evicted, or on export.
+			// Returned pointers remain valid until the entry is evicted, dropped, or its file is overwritten.
+			rwsd* getCachedRWSD(unsigned long fileIDIn, bool forEditing = 0);
+			bool flushRWSDCacheEntry(unsigned long fileIDIn);
+			bool flushRWSDCache();
+			void dropRWSDCacheEntry(unsigned long fileIDIn);
+			bool clearRWSDCache(bool flushFirst = 1);
+			void setRWSDCacheByteBudget(unsigned long budgetIn);
+			unsigned long getRWSDCacheByteBudget() const;
+
+			// In-Place RWSD Edit Funcs
+			// These patch the RWSD's header and raw data directly instead of parsing and re-exporting the whole file;
+			// only the WAVE section is parsed and rebuilt, and existing wave packets are carried over byte-for-byte.
+			// Truncating fails if any DATA entry still uses a wave which would be removed.
+			bool rwsdAppendWaves(unsigned long fileIDIn, const waveInfo& sourceWaveIn, unsigned long countIn);
+			bool rwsdAppendWaves(unsigned long fileIDIn, unsigned long sourceWaveIndexIn, unsigned long countIn, bool hollowOutNewWaves = 0);
+			bool rwsdTruncateWaves(unsigned long fileIDIn, unsigned long remainingWaveCountIn, bool zeroOutRemainingWaves = 0);
+			// Runs rwsd::removeUnreferencedWaves() on every RWSD in parallel, and reports the savings for each file to reportOut.
+			bool removeUnreferencedWaves(unsigned long threadCount = 0, std::ostream* reportOut = &std::cout, unsigned long* totalBytesReclaimedOut = nullptr);
+			// Reports how much space rwsd::mergeDuplicateWaves() would save in each RWSD, without changing anything.
+			bool analyzeDuplicateWaves(std::ostream& reportOut = std::cout, unsigned long threadCount = 0, unsigned long* totalBytesReclaimableOut = nullptr);
+
+			// Batch File Funcs
+			// Runs stageFuncIn on a copy of each listed file's contents concurrently (repeated IDs are only processed once), then commits
+			// the results to the BRSAR in list order, with a single address update. stageFuncIn may only modify the contents it's handed.
+			// Nothing is committed unless every file's stage succeeds. succeededOut receives each listed file's stage result.
+			bool batchProcessFiles(const std::vector<unsigned long>& fileIDsIn, const std::function<bool(unsigned long, brsarFileFileContents&)>& stageFuncIn,
+				unsigned long threadCount = 0, std::vector<char>* succeededOut = nullptr);
+			// Parses, edits, and re-exports each listed RWSD concurrently through batchProcessFiles().
+			bool batchEditRWSDs(const std::vector<unsigned long>& fileIDsIn, const std::function<bool(unsigned long, rwsd&)>& editFuncIn,
+				unsigned long threadCount = 0, std::vector<char>* succeededOut = nullptr);
+			// As above, for RBNKs.
+			bool batchEditRBNKs(const std::vector<unsigned long>& fileIDsIn, const std::function<bool(unsigned long, rbnk&)>& editFuncIn,
+				unsigned long threadCount = 0, std::vector<char>* succeededOut = nullptr);
+			bool batchAppendWaves(const std::vector<unsigned long>& fileIDsIn, unsigned long sourceWaveIndexIn, unsigned long countIn, bool hollowOutNewWaves = 0,
+				unsigned long threadCount = 0, std::vector<char>* succeededOut = nullptr);
+			bool batchTruncateWaves(const std::vector<unsigned long>& fileIDsIn, unsigned long remainingWaveCountIn, bool zeroOutRemainingWaves = 0,
+				unsigned long threadCount = 0, std::vector<char>* succeededOut = nullptr);
+
+			// Parses and re-exports the given file contents, writing the result to contentsOut. Fails for unparsed file types.
+			static bool canRoundTripFileType(unsigned long fileTypeIn);
+			static bool roundTripFileContents(const brsarFileFileContents& contentsIn, brsarFileFileContents& contentsOut);
+			// Round trips every parsed subfile in parallel, recording where any re-exported file diverges from the original.
+			// Returns true only if every parsed subfile matched.
+			bool verifyRoundTrips(std::vector<brsarRoundTripResult>& resultsOut, unsigned long threadCount = 0);
+
+			// Runs scanFuncIn over the sequence data of every RSEQ in the archive, spread across threads.
+			// scanFuncIn must be safe to call concurrently. succeededOut receives each RSEQ's file ID and result, in file order.
+			bool scanRSEQs(const std::function<bool(unsigned long, rseqEventIterator)>& scanFuncIn, unsigned long threadCount = 0,
+				std::vector<std::pair<unsigned long, bool>>* succeededOut = nullptr);
+			// Maps each RSEQ's file ID to the program numbers it sets.
+			bool getRSEQProgramUsage(std::unordered_map<unsigned long, std::vector<unsigned long>>& programsOut, unsigned long threadCount = 0);
+
+			// Exports every wave in each listed RWSD to "{OUTPUT_DIR}file_{FILE_ID}_wav_{WAVE_INDEX}.wav", creating directories as needed.
+			// Parsing, decoding, and writing run as overlapping stages, connected by bounded queues so that only a few RWSDs
+			// are ever held in memory at once, regardless of how many are listed.
+			bool exportWAVs(const std::vector<std::pair<unsigned long, std::string>>& fileIDsToOutputDirsIn, unsigned long threadCount = 0,
+				brsarWaveExportStats* statsOut = nullptr, std::ostream* progressOut = &std::cout);
+			bool exportWAVs(const std::vector<unsigned long>& fileIDsIn, std::string outputDirectory, unsigned long threadCount = 0,
+				brsarWaveExportStats* statsOut = nullptr, std::ostream* progressOut = &std::cout);
+
 			bool overwriteFile(const std::vector<unsigned char>& headerIn, const std::vector<unsigned char>& dataIn, unsigned long fileIDIn);
 			bool cloneFile(unsigned long fileIDToClone, unsigned long groupToLink);
 
@@ -819,6 +1534,58 @@ namespace lava
 
 		/* BRSAR */
 
+
+
+		/* BRSAR Sound Catalog */
+
+		struct brsarSoundCatalogEntry
+		{
+			unsigned long soundID = ULONG_MAX;
+			std::string name = "";
+			unsigned char soundType = UCHAR_MAX;
+			unsigned long fileID = ULONG_MAX;
+			std::vector<unsigned long> groupIDs{};
+
+			// Wave Sounds Only
+			unsigned long dataIndex = ULONG_MAX;
+			unsigned long waveIndex = ULONG_MAX;
+			unsigned long sampleRate = ULONG_MAX;
+			unsigned long lengthInSamples = ULONG_MAX;
+
+			// For Wave Sounds, the size of the wave's audio data; for Sequence Sounds, the size of the RSEQ file.
+			unsigned long byteSize = ULONG_MAX;
+
+			bool populate(const lava::byteArray& bodyIn, std::size_t addressIn, std::size_t* nextAddressOut = nullptr);
+			bool exportContents(std::ostream& destinationStream) const;
+		};
+		struct brsarSoundCatalog
+		{
+			static constexpr unsigned long catalogTag = 0x4C534354; // "LSCT"
+			static constexpr unsigned long catalogVersion = 0x02;
+
+			// MD5 of the source BRSAR's SYMB and INFO sections and its RWSD headers, used to detect stale sidecar files.
+			// Covers everything the entries are built from, so renames and relinks are caught even when sizes don't change.
+			std::array<unsigned char, MD5::HashBytes> sourceHash{};
+
+			// Indexed by Sound ID.
+			std::vector<brsarSoundCatalogEntry> entries{};
+			std::unordered_map<std::string, unsigned long> namesToSoundIDs{};
+
+			static std::array<unsigned char, MD5::HashBytes> calculateSourceHash(brsar& sourceBrsarIn);
+			bool build(brsar& sourceBrsarIn, unsigned long threadCount = 0);
+			bool isUpToDate(brsar& sourceBrsarIn) const;
+
+			const brsarSoundCatalogEntry* getEntryWithID(unsigned long soundIDIn) const;
+			const brsarSoundCatalogEntry* getEntryWithName(const std::string& nameIn) const;
+
+			bool populate(std::string filePathIn);
+			bool exportContents(std::ostream& destinationStream) const;
+			bool exportContents(std::string outputFilename) const;
+			bool summarize(std::ostream& output) const;
+		};
+
+		/* BRSAR Sound Catalog */
+
 	}
 }
 
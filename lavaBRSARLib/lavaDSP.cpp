@@ -1,4 +1,11 @@
 #include "lavaDSP.h"
+#include <numeric>
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
 
 namespace lava
 {
@@ -28,6 +35,1275 @@ namespace lava
 			return nibblesToBytes(samplesToNibbles(samplesIn));
 		}
 
+		unsigned long sampleToNibbleAddress(unsigned long sampleIn)
+		{
+			return ((sampleIn / 0x0E) * 0x10) + (sampleIn % 0x0E) + 2;
+		}
+
+		// The following coefficient search is a port of DSPCorrelateCoefs, following VGAudio's version of it, down to its rounding and overflow behavior.
+		// See here: https://github.com/Thealexbarney/VGAudio/blob/9d8f6ea04c83cccccb3dd7851a631bbd53a8dbbe/src/VGAudio/Codecs/GcAdpcm/GcAdpcmCoefficients.cs
+		typedef std::array<double, 3> gcADPCMVec;
+		static void innerProductMerge(gcADPCMVec& vecOut, const std::array<signed short, 0x1C>& pcmBufIn)
+		{
+			for (int i = 0; i <= 2; i++)
+			{
+				vecOut[i] = 0.0;
+				for (int x = 0; x < 14; x++)
+				{
+					vecOut[i] -= pcmBufIn[14 + x - i] * pcmBufIn[14 + x];
+				}
+			}
+		}
+		static void outerProductMerge(std::array<gcADPCMVec, 3>& mtxOut, const std::array<signed short, 0x1C>& pcmBufIn)
+		{
+			for (int x = 1; x <= 2; x++)
+			{
+				for (int y = 1; y <= 2; y++)
+				{
+					mtxOut[x][y] = 0.0;
+					for (int z = 0; z < 14; z++)
+					{
+						mtxOut[x][y] += pcmBufIn[14 + z - x] * pcmBufIn[14 + z - y];
+					}
+				}
+			}
+		}
+		static bool analyzeRanges(std::array<gcADPCMVec, 3>& mtx, std::array<int, 3>& vecIdxsOut)
+		{
+			std::array<double, 3> recips{};
+			double val = 0.0;
+			double tmp = 0.0;
+
+			// Get greatest distance from zero
+			for (int x = 1; x <= 2; x++)
+			{
+				val = std::max(std::fabs(mtx[x][1]), std::fabs(mtx[x][2]));
+				if (val < DBL_EPSILON)
+				{
+					return 1;
+				}
+				recips[x] = 1.0 / val;
+			}
+
+			int maxIndex = 0;
+			for (int i = 1; i <= 2; i++)
+			{
+				for (int x = 1; x < i; x++)
+				{
+					tmp = mtx[x][i];
+					for (int y = 1; y < x; y++)
+					{
+						tmp -= mtx[x][y] * mtx[y][i];
+					}
+					mtx[x][i] = tmp;
+				}
+
+				val = 0.0;
+				for (int x = i; x <= 2; x++)
+				{
+					tmp = mtx[x][i];
+					for (int y = 1; y < i; y++)
+					{
+						tmp -= mtx[x][y] * mtx[y][i];
+					}
+					mtx[x][i] = tmp;
+					tmp = std::fabs(tmp) * recips[x];
+					if (tmp >= val)
+					{
+						val = tmp;
+						maxIndex = x;
+					}
+				}
+
+				if (maxIndex != i)
+				{
+					for (int y = 1; y <= 2; y++)
+					{
+						std::swap(mtx[maxIndex][y], mtx[i][y]);
+					}
+					recips[maxIndex] = recips[i];
+				}
+
+				vecIdxsOut[i] = maxIndex;
+
+				if (mtx[i][i] == 0.0)
+				{
+					return 1;
+				}
+
+				if (i != 2)
+				{
+					tmp = 1.0 / mtx[i][i];
+					for (int x = i + 1; x <= 2; x++)
+					{
+						mtx[x][i] *= tmp;
+					}
+				}
+			}
+
+			// Get range
+			double min = 1.0e10;
+			double max = 0.0;
+			for (int i = 1; i <= 2; i++)
+			{
+				tmp = std::fabs(mtx[i][i]);
+				min = std::min(min, tmp);
+				max = std::max(max, tmp);
+			}
+
+			return (min / max) < 1.0e-10;
+		}
+		static void bidirectionalFilter(const std::array<gcADPCMVec, 3>& mtx, const std::array<int, 3>& vecIdxs, gcADPCMVec& vecOut)
+		{
+			double tmp = 0.0;
+
+			for (int i = 1, x = 0; i <= 2; i++)
+			{
+				int index = vecIdxs[i];
+				tmp = vecOut[index];
+				vecOut[index] = vecOut[i];
+				if (x != 0)
+				{
+					for (int y = x; y <= i - 1; y++)
+					{
+						tmp -= vecOut[y] * mtx[i][y];
+					}
+				}
+				else if (tmp != 0.0)
+				{
+					x = i;
+				}
+				vecOut[i] = tmp;
+			}
+
+			for (int i = 2; i > 0; i--)
+			{
+				tmp = vecOut[i];
+				for (int y = i + 1; y <= 2; y++)
+				{
+					tmp -= vecOut[y] * mtx[i][y];
+				}
+				vecOut[i] = tmp / mtx[i][i];
+			}
+
+			vecOut[0] = 1.0;
+		}
+		static bool quadraticMerge(gcADPCMVec& inOutVec)
+		{
+			double v2 = inOutVec[2];
+			double tmp = 1.0 - (v2 * v2);
+
+			if (tmp == 0.0)
+			{
+				return 1;
+			}
+
+			double v0 = (inOutVec[0] - (v2 * v2)) / tmp;
+			double v1 = (inOutVec[1] - (inOutVec[1] * v2)) / tmp;
+
+			inOutVec[0] = v0;
+			inOutVec[1] = v1;
+
+			return std::fabs(v1) > 1.0;
+		}
+		static void finishRecord(gcADPCMVec& in, gcADPCMVec& out)
+		{
+			for (int z = 1; z <= 2; z++)
+			{
+				if (in[z] >= 1.0)
+				{
+					in[z] = 0.9999999999;
+				}
+				else if (in[z] <= -1.0)
+				{
+					in[z] = -0.9999999999;
+				}
+			}
+			out[0] = 1.0;
+			out[1] = (in[2] * in[1]) + in[1];
+			out[2] = in[2];
+		}
+		static void matrixFilter(const gcADPCMVec& src, gcADPCMVec& dst)
+		{
+			std::array<gcADPCMVec, 3> mtx{};
+
+			mtx[2][0] = 1.0;
+			for (int i = 1; i <= 2; i++)
+			{
+				mtx[2][i] = -src[i];
+			}
+
+			for (int i = 2; i > 0; i--)
+			{
+				double val = 1.0 - (mtx[i][i] * mtx[i][i]);
+				for (int y = 1; y <= i; y++)
+				{
+					mtx[i - 1][y] = ((mtx[i][i] * mtx[i][y]) + mtx[i][y]) / val;
+				}
+			}
+
+			dst[0] = 1.0;
+			for (int i = 1; i <= 2; i++)
+			{
+				dst[i] = 0.0;
+				for (int y = 1; y <= i; y++)
+				{
+					dst[i] += mtx[i][y] * dst[i - y];
+				}
+			}
+		}
+		static void mergeFinishRecord(const gcADPCMVec& src, gcADPCMVec& dst)
+		{
+			gcADPCMVec tmp{};
+			double val = src[0];
+
+			dst[0] = 1.0;
+			for (int i = 1; i <= 2; i++)
+			{
+				double v2 = 0.0;
+				for (int y = 1; y < i; y++)
+				{
+					v2 += dst[y] * src[i - y];
+				}
+
+				dst[i] = (val > 0.0) ? -(v2 + src[i]) / val : 0.0;
+				tmp[i] = dst[i];
+
+				for (int y = 1; y < i; y++)
+				{
+					dst[y] += dst[i] * dst[i - y];
+				}
+
+				val *= 1.0 - (dst[i] * dst[i]);
+			}
+
+			finishRecord(tmp, dst);
+		}
+		static double contrastVectors(const gcADPCMVec& source1, const gcADPCMVec& source2)
+		{
+			double val = (source2[2] * source2[1] + -source2[1]) / (1.0 - source2[2] * source2[2]);
+			double val1 = (source1[0] * source1[0]) + (source1[1] * source1[1]) + (source1[2] * source1[2]);
+			double val2 = (source1[0] * source1[1]) + (source1[1] * source1[2]);
+			double val3 = source1[0] * source1[2];
+			return val1 + (2.0 * val * val2) + (2.0 * (-source2[1] * val + -source2[2]) * val3);
+		}
+		static void filterRecords(std::array<gcADPCMVec, 8>& vecBest, int exp, const std::vector<gcADPCMVec>& records)
+		{
+			std::array<gcADPCMVec, 8> bufferList{};
+			std::array<int, 8> buffer1{};
+			gcADPCMVec buffer2{};
+
+			for (int x = 0; x < 2; x++)
+			{
+				for (int y = 0; y < exp; y++)
+				{
+					buffer1[y] = 0;
+					bufferList[y].fill(0.0);
+				}
+				for (std::size_t z = 0; z < records.size(); z++)
+				{
+					int index = 0;
+					double value = 1.0e30;
+					for (int i = 0; i < exp; i++)
+					{
+						double tempVal = contrastVectors(vecBest[i], records[z]);
+						if (tempVal < value)
+						{
+							value = tempVal;
+							index = i;
+						}
+					}
+					buffer1[index]++;
+					matrixFilter(records[z], buffer2);
+					for (int i = 0; i <= 2; i++)
+					{
+						bufferList[index][i] += buffer2[i];
+					}
+				}
+
+				for (int i = 0; i < exp; i++)
+				{
+					if (buffer1[i] > 0)
+					{
+						for (int y = 0; y <= 2; y++)
+						{
+							bufferList[i][y] /= buffer1[i];
+						}
+					}
+				}
+
+				for (int i = 0; i < exp; i++)
+				{
+					mergeFinishRecord(bufferList[i], vecBest[i]);
+				}
+			}
+		}
+		void calculateGCADPCMCoefficients(const signed short* samplesIn, std::size_t sampleCountIn, std::array<unsigned short, 0x10>& coefficientsOut, unsigned long threadCount)
+		{
+			// Each frame's record only depends on that frame and the one before it, so they can be worked out in parallel.
+			// They're still gathered back up in order, so the result is the same regardless of thread count.
+			std::size_t frameCount = (sampleCountIn + 13) / 14;
+			std::vector<gcADPCMVec> frameRecords(frameCount);
+			std::vector<char> frameHasRecord(frameCount, 0);
+			std::size_t framesPerChunk = 0x400;
+			std::size_t chunkCount = (frameCount + framesPerChunk - 1) / framesPerChunk;
+			lava::parallelFor(chunkCount, [&](std::size_t chunkIndex)
+			{
+				std::array<signed short, 0x1C> pcmHistBuffer{};
+				gcADPCMVec vec1{};
+				std::array<gcADPCMVec, 3> mtx{};
+				std::array<int, 3> vecIdxs{};
+
+				std::size_t chunkStart = chunkIndex * framesPerChunk;
+				std::size_t chunkEnd = std::min(frameCount, chunkStart + framesPerChunk);
+				if (chunkStart > 0)
+				{
+					std::copy(samplesIn + ((chunkStart - 1) * 14), samplesIn + (chunkStart * 14), pcmHistBuffer.begin() + 14);
+				}
+				for (std::size_t frame = chunkStart; frame < chunkEnd; frame++)
+				{
+					std::copy(pcmHistBuffer.begin() + 14, pcmHistBuffer.end(), pcmHistBuffer.begin());
+					std::fill(pcmHistBuffer.begin() + 14, pcmHistBuffer.end(), 0);
+					std::size_t frameSampleCount = std::min<std::size_t>(14, sampleCountIn - (frame * 14));
+					std::copy(samplesIn + (frame * 14), samplesIn + (frame * 14) + frameSampleCount, pcmHistBuffer.begin() + 14);
+
+					innerProductMerge(vec1, pcmHistBuffer);
+					if (std::fabs(vec1[0]) > 10.0)
+					{
+						outerProductMerge(mtx, pcmHistBuffer);
+						if (!analyzeRanges(mtx, vecIdxs))
+						{
+							bidirectionalFilter(mtx, vecIdxs, vec1);
+							if (!quadraticMerge(vec1))
+							{
+								finishRecord(vec1, frameRecords[frame]);
+								frameHasRecord[frame] = 1;
+							}
+						}
+					}
+				}
+			}, threadCount);
+			std::vector<gcADPCMVec> records{};
+			for (std::size_t i = 0; i < frameCount; i++)
+			{
+				if (frameHasRecord[i])
+				{
+					records.push_back(frameRecords[i]);
+				}
+			}
+
+			std::array<gcADPCMVec, 8> vecBest{};
+			gcADPCMVec vec1 = { 1.0, 0.0, 0.0 };
+			for (std::size_t z = 0; z < records.size(); z++)
+			{
+				matrixFilter(records[z], vecBest[0]);
+				for (int y = 1; y <= 2; y++)
+				{
+					vec1[y] += vecBest[0][y];
+				}
+			}
+			// Silence produces no records at all; leave the averages at zero rather than dividing by zero.
+			if (!records.empty())
+			{
+				for (int y = 1; y <= 2; y++)
+				{
+					vec1[y] /= records.size();
+				}
+			}
+			mergeFinishRecord(vec1, vecBest[0]);
+
+			int exp = 1;
+			for (int w = 0; w < 3;)
+			{
+				gcADPCMVec vec2 = { 0.0, -1.0, 0.0 };
+				for (int i = 0; i < exp; i++)
+				{
+					for (int y = 0; y <= 2; y++)
+					{
+						vecBest[exp + i][y] = (0.01 * vec2[y]) + vecBest[i][y];
+					}
+				}
+				++w;
+				exp = 1 << w;
+				filterRecords(vecBest, exp, records);
+			}
+
+			// VGAudio rounds with Math.Round, which rounds halfway cases to even; nearbyint does the same under the default rounding mode.
+			for (int z = 0; z < 8; z++)
+			{
+				for (int y = 0; y < 2; y++)
+				{
+					double d = -vecBest[z][y + 1] * 2048.0;
+					signed short coefficient = 0;
+					if (d > 0.0)
+					{
+						coefficient = (d > SHRT_MAX) ? SHRT_MAX : signed short(std::nearbyint(d));
+					}
+					else
+					{
+						coefficient = (d < SHRT_MIN) ? SHRT_MIN : signed short(std::nearbyint(d));
+					}
+					coefficientsOut[(z * 2) + y] = unsigned short(coefficient);
+				}
+			}
+		}
+
+		// Encodes one frame, trying each predictor in turn. pcmInOut holds the two history samples followed by the frame's 14 samples;
+		// on return, the frame's samples are replaced with their decoded values so that they can serve as history for the next frame.
+		static void encodeGCADPCMFrame(std::array<signed long, 0x10>& pcmInOut, const std::array<signed long, 0x10>& coefsIn, unsigned char* adpcmOut, bool fastModeIn)
+		{
+			std::array<std::array<signed long, 0x10>, 8> inSamples{};
+			std::array<std::array<signed long, 0x0E>, 8> outSamples{};
+			std::array<signed long, 8> scale{};
+			std::array<double, 8> distAccum{};
+			distAccum.fill(DBL_MAX);
+
+			// In fast mode, only the two predictors which best fit the original samples get the full scale search.
+			std::array<std::size_t, 8> candidates = { 0, 1, 2, 3, 4, 5, 6, 7 };
+			std::size_t candidateCount = candidates.size();
+			if (fastModeIn)
+			{
+				std::array<double, 8> predictionError{};
+				for (std::size_t i = 0; i < 8; i++)
+				{
+					for (std::size_t s = 0; s < 14; s++)
+					{
+						double residual = pcmInOut[s + 2] - (((pcmInOut[s] * coefsIn[(i * 2) + 1]) + (pcmInOut[s + 1] * coefsIn[i * 2])) / 2048.0);
+						predictionError[i] += residual * residual;
+					}
+				}
+				std::partial_sort(candidates.begin(), candidates.begin() + 2, candidates.end(),
+					[&predictionError](std::size_t a, std::size_t b) { return predictionError[a] < predictionError[b]; });
+				candidateCount = 2;
+			}
+
+			for (std::size_t candidate = 0; candidate < candidateCount; candidate++)
+			{
+				std::size_t i = candidates[candidate];
+				signed long coef1 = coefsIn[i * 2];
+				signed long coef2 = coefsIn[(i * 2) + 1];
+				signed long v1 = 0;
+				signed long v2 = 0;
+				signed long v3 = 0;
+
+				inSamples[i][0] = pcmInOut[0];
+				inSamples[i][1] = pcmInOut[1];
+
+				signed long distance = 0;
+				for (std::size_t s = 0; s < 14; s++)
+				{
+					// These can overflow in VGAudio, which wraps; do the same.
+					inSamples[i][s + 2] = v1 = signed long(((((signed long long)pcmInOut[s]) * coef2) + (((signed long long)pcmInOut[s + 1]) * coef1))) / 2048;
+					v2 = pcmInOut[s + 2] - v1;
+					v3 = (v2 >= SHRT_MAX) ? SHRT_MAX : (v2 <= SHRT_MIN) ? SHRT_MIN : v2;
+					if (std::abs(v3) > std::abs(distance))
+					{
+						distance = v3;
+					}
+				}
+
+				for (scale[i] = 0; (scale[i] <= 12) && ((distance > 7) || (distance < -8)); scale[i]++, distance /= 2) {}
+				scale[i] = (scale[i] <= 1) ? -1 : scale[i] - 2;
+
+				signed long index = 0;
+				do
+				{
+					scale[i]++;
+					distAccum[i] = 0;
+					index = 0;
+
+					for (std::size_t s = 0; s < 14; s++)
+					{
+						v1 = signed long((((signed long long)inSamples[i][s]) * coef2) + (((signed long long)inSamples[i][s + 1]) * coef1));
+						v2 = ((pcmInOut[s + 2] * 2048) - v1) / 2048;
+						v3 = (v2 > 0) ? signed long(double(v2) / (1 << scale[i]) + 0.4999999f) : signed long(double(v2) / (1 << scale[i]) - 0.4999999f);
+
+						if (v3 < -8)
+						{
+							if (index < (v3 = -8 - v3))
+							{
+								index = v3;
+							}
+							v3 = -8;
+						}
+						else if (v3 > 7)
+						{
+							if (index < (v3 -= 7))
+							{
+								index = v3;
+							}
+							v3 = 7;
+						}
+
+						outSamples[i][s] = v3;
+
+						v1 = (v1 + ((v3 * (1 << scale[i])) * 2048) + 1024) >> 11;
+						inSamples[i][s + 2] = v2 = (v1 >= SHRT_MAX) ? SHRT_MAX : (v1 <= SHRT_MIN) ? SHRT_MIN : v1;
+						v3 = pcmInOut[s + 2] - v2;
+						distAccum[i] += v3 * double(v3);
+					}
+
+					for (signed long x = index + 8; x > 256; x >>= 1)
+					{
+						if (++scale[i] >= 12)
+						{
+							scale[i] = 11;
+						}
+					}
+				} while ((scale[i] < 12) && (index > 1));
+			}
+
+			std::size_t bestIndex = 0;
+			double min = DBL_MAX;
+			for (std::size_t i = 0; i < 8; i++)
+			{
+				if (distAccum[i] < min)
+				{
+					min = distAccum[i];
+					bestIndex = i;
+				}
+			}
+
+			for (std::size_t s = 0; s < 14; s++)
+			{
+				pcmInOut[s + 2] = inSamples[bestIndex][s + 2];
+			}
+			adpcmOut[0] = unsigned char((bestIndex << 4) | (scale[bestIndex] & 0xF));
+			for (std::size_t y = 0; y < 7; y++)
+			{
+				adpcmOut[y + 1] = unsigned char((outSamples[bestIndex][y * 2] << 4) | (outSamples[bestIndex][(y * 2) + 1] & 0xF));
+			}
+		}
+		bool encodeGCADPCM(const signed short* samplesIn, std::size_t sampleCountIn, const std::array<unsigned short, 0x10>& coefficientsIn,
+			std::vector<unsigned char>& dataOut, unsigned char encodeModeIn, unsigned long threadCount)
+		{
+			bool result = 0;
+
+			if (samplesIn != nullptr || sampleCountIn == 0)
+			{
+				std::array<signed long, 0x10> coefs{};
+				for (std::size_t i = 0; i < coefs.size(); i++)
+				{
+					coefs[i] = signed short(coefficientsIn[i]);
+				}
+
+				std::size_t frameCount = (sampleCountIn + 13) / 14;
+				dataOut.assign(samplesToBytes(unsigned long(sampleCountIn)), 0x00);
+				bool fastMode = encodeModeIn == gcADPCMEncodeModes::gaem_FAST;
+				// Encodes a frame given the two decoded samples before it, writes it out, and returns the frame's last two decoded samples.
+				auto encodeFrameAt = [&](std::size_t frame, std::pair<signed long, signed long> historyIn)
+				{
+					std::array<signed long, 0x10> pcmBuffer{};
+					std::array<unsigned char, _GC_ADPCM_FRAME_LENGTH> adpcmBuffer{};
+					pcmBuffer[0] = historyIn.first;
+					pcmBuffer[1] = historyIn.second;
+					std::size_t frameSampleCount = std::min<std::size_t>(14, sampleCountIn - (frame * 14));
+					std::copy(samplesIn + (frame * 14), samplesIn + (frame * 14) + frameSampleCount, pcmBuffer.begin() + 2);
+
+					encodeGCADPCMFrame(pcmBuffer, coefs, adpcmBuffer.data(), fastMode);
+
+					// The final frame only keeps the bytes its samples need.
+					std::size_t frameByteCount = std::min<std::size_t>(_GC_ADPCM_FRAME_LENGTH, dataOut.size() - (frame * _GC_ADPCM_FRAME_LENGTH));
+					std::copy(adpcmBuffer.begin(), adpcmBuffer.begin() + frameByteCount, dataOut.begin() + (frame * _GC_ADPCM_FRAME_LENGTH));
+					return std::make_pair(pcmBuffer[14], pcmBuffer[15]);
+				};
+
+				// Each frame's history comes from the decoded output of the last, so exact encoding has to run in order.
+				// In fast mode, long waves are split into segments which instead take their starting history from the input PCM.
+				std::size_t framesPerSegment = (fastMode) ? 0x800 : std::max<std::size_t>(frameCount, 1);
+				std::size_t segmentCount = (frameCount + framesPerSegment - 1) / framesPerSegment;
+				std::vector<std::pair<signed long, signed long>> frameEndHistories(frameCount);
+				std::vector<std::pair<signed long, signed long>> segmentStartHistories(segmentCount);
+				lava::parallelFor(segmentCount, [&](std::size_t segmentIndex)
+				{
+					std::size_t segmentStart = segmentIndex * framesPerSegment;
+					std::size_t segmentEnd = std::min(frameCount, segmentStart + framesPerSegment);
+					std::pair<signed long, signed long> history(0, 0);
+					if (segmentStart > 0)
+					{
+						history = std::make_pair(signed long(samplesIn[(segmentStart * 14) - 2]), signed long(samplesIn[(segmentStart * 14) - 1]));
+					}
+					segmentStartHistories[segmentIndex] = history;
+					for (std::size_t frame = segmentStart; frame < segmentEnd; frame++)
+					{
+						history = encodeFrameAt(frame, history);
+						frameEndHistories[frame] = history;
+					}
+				}, (fastMode) ? threadCount : 1);
+
+				// The decoder won't see those guessed histories though, so re-encode from each seam using the real ones.
+				// The decoded output tends to converge within a frame or two, at which point the rest of the segment is already correct.
+				for (std::size_t segmentIndex = 1; segmentIndex < segmentCount; segmentIndex++)
+				{
+					std::size_t segmentStart = segmentIndex * framesPerSegment;
+					std::pair<signed long, signed long> expectedHistory = segmentStartHistories[segmentIndex];
+					std::pair<signed long, signed long> history = frameEndHistories[segmentStart - 1];
+					for (std::size_t frame = segmentStart; frame < frameCount && history != expectedHistory; frame++)
+					{
+						expectedHistory = frameEndHistories[frame];
+						history = encodeFrameAt(frame, history);
+						frameEndHistories[frame] = history;
+					}
+				}
+				result = 1;
+			}
+
+			return result;
+		}
+		bool cpuSupportsAVX2()
+		{
+			static const bool result = []()
+			{
+				bool supported = 0;
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+				int cpuInfo[4] = {};
+				__cpuid(cpuInfo, 0);
+				if (cpuInfo[0] >= 7)
+				{
+					__cpuid(cpuInfo, 1);
+					// The OS has to be saving the YMM registers too, or using them isn't safe.
+					bool osSavesYMM = (cpuInfo[2] & (1 << 27)) && (cpuInfo[2] & (1 << 28)) && ((_xgetbv(0) & 0x6) == 0x6);
+					__cpuidex(cpuInfo, 7, 0);
+					supported = osSavesYMM && (cpuInfo[1] & (1 << 5));
+				}
+#elif defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+				supported = __builtin_cpu_supports("avx2");
+#endif
+				return supported;
+			}();
+			return result;
+		}
+
+		unsigned long rescaleSampleIndex(unsigned long sampleIn, unsigned long sourceRateIn, unsigned long targetRateIn)
+		{
+			unsigned long result = sampleIn;
+
+			if (sourceRateIn != 0 && targetRateIn != 0)
+			{
+				result = unsigned long(((unsigned long long)(sampleIn) * targetRateIn + (sourceRateIn / 2)) / sourceRateIn);
+			}
+
+			return result;
+		}
+
+		// Filter taps are laid out in blocks of this many, which is what one AVX2 register holds.
+		constexpr std::size_t _RESAMPLER_TAP_BLOCK = 0x08;
+		// Zero crossings of the sinc on either side of its center. More gives a sharper cutoff, at the cost of longer filters.
+		constexpr double _RESAMPLER_ZERO_CROSSINGS = 16.0;
+		constexpr double _RESAMPLER_KAISER_BETA = 8.6;
+		// Rates with no small common ratio (e.g. 44100 to 32001) get their phases rounded to the nearest of this many instead.
+		constexpr unsigned long _RESAMPLER_MAX_PHASES = 0x1000;
+		constexpr double _RESAMPLER_PI = 3.14159265358979323846;
+
+		static double besselI0(double x)
+		{
+			double result = 1.0;
+			double term = 1.0;
+			for (int k = 1; k < 50 && term > (result * 1.0e-12); k++)
+			{
+				double factor = x / (2.0 * k);
+				term *= factor * factor;
+				result += term;
+			}
+			return result;
+		}
+		static float dotProductScalar(const float* samplesIn, const float* tapsIn, std::size_t tapCountIn)
+		{
+			// Accumulate in eight lanes, the same way the AVX2 version does, so that both round identically.
+			std::array<float, _RESAMPLER_TAP_BLOCK> lanes{};
+			for (std::size_t i = 0; i < tapCountIn; i += _RESAMPLER_TAP_BLOCK)
+			{
+				for (std::size_t u = 0; u < _RESAMPLER_TAP_BLOCK; u++)
+				{
+					lanes[u] += samplesIn[i + u] * tapsIn[i + u];
+				}
+			}
+			float low = (lanes[0] + lanes[4]) + (lanes[2] + lanes[6]);
+			float high = (lanes[1] + lanes[5]) + (lanes[3] + lanes[7]);
+			return low + high;
+		}
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#if defined(__GNUC__)
+		__attribute__((target("avx2")))
+#endif
+		static float dotProductAVX2(const float* samplesIn, const float* tapsIn, std::size_t tapCountIn)
+		{
+			__m256 accumulator = _mm256_setzero_ps();
+			for (std::size_t i = 0; i < tapCountIn; i += _RESAMPLER_TAP_BLOCK)
+			{
+				accumulator = _mm256_add_ps(accumulator, _mm256_mul_ps(_mm256_loadu_ps(samplesIn + i), _mm256_loadu_ps(tapsIn + i)));
+			}
+			// Lanes 0-3 + 4-7, then 0-1 + 2-3, then 0 + 1; the same pairing dotProductScalar uses.
+			__m128 sum = _mm_add_ps(_mm256_castps256_ps128(accumulator), _mm256_extractf128_ps(accumulator, 1));
+			sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+			sum = _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, 0x55));
+			return _mm_cvtss_f32(sum);
+		}
+#else
+		static float dotProductAVX2(const float* samplesIn, const float* tapsIn, std::size_t tapCountIn)
+		{
+			return dotProductScalar(samplesIn, tapsIn, tapCountIn);
+		}
+#endif
+		bool resamplePCM(const signed short* samplesIn, std::size_t sampleCountIn, unsigned long sourceRateIn, unsigned long targetRateIn,
+			std::vector<signed short>& samplesOut)
+		{
+			bool result = 0;
+
+			if ((samplesIn != nullptr || sampleCountIn == 0) && sourceRateIn != 0 && targetRateIn != 0)
+			{
+				result = 1;
+				if (sourceRateIn == targetRateIn)
+				{
+					samplesOut.assign(samplesIn, samplesIn + sampleCountIn);
+				}
+				else
+				{
+					// Output sample n sits at input position n * (downFactor / upFactor).
+					unsigned long long rateDivisor = std::gcd<unsigned long long>(sourceRateIn, targetRateIn);
+					unsigned long long upFactor = targetRateIn / rateDivisor;
+					unsigned long long downFactor = sourceRateIn / rateDivisor;
+					unsigned long phaseCount = unsigned long(std::min<unsigned long long>(upFactor, _RESAMPLER_MAX_PHASES));
+
+					// Build the filter bank, one set of taps for each fractional position between input samples.
+					double cutoffScale = std::min(1.0, double(targetRateIn) / double(sourceRateIn));
+					double cutoff = 0.5 * cutoffScale * 0.97;
+					std::size_t halfTapCount = std::size_t(std::ceil(_RESAMPLER_ZERO_CROSSINGS / cutoffScale));
+					std::size_t tapCount = ((halfTapCount * 2) + _RESAMPLER_TAP_BLOCK - 1) & ~(_RESAMPLER_TAP_BLOCK - 1);
+					std::vector<float> filterBank(phaseCount * tapCount, 0.0f);
+					double windowNormalizer = besselI0(_RESAMPLER_KAISER_BETA);
+					for (std::size_t phase = 0; phase < phaseCount; phase++)
+					{
+						double fraction = double(phase) / phaseCount;
+						float* taps = filterBank.data() + (phase * tapCount);
+						double tapSum = 0.0;
+						std::vector<double> phaseTaps(halfTapCount * 2, 0.0);
+						for (std::size_t i = 0; i < phaseTaps.size(); i++)
+						{
+							double t = (double(i) - double(halfTapCount - 1)) - fraction;
+							double windowPosition = t / double(halfTapCount);
+							if (std::fabs(windowPosition) < 1.0)
+							{
+								double x = 2.0 * cutoff * t;
+								double sinc = (std::fabs(x) < 1.0e-9) ? 1.0 : std::sin(_RESAMPLER_PI * x) / (_RESAMPLER_PI * x);
+								double window = besselI0(_RESAMPLER_KAISER_BETA * std::sqrt(1.0 - (windowPosition * windowPosition))) / windowNormalizer;
+								phaseTaps[i] = sinc * window;
+								tapSum += phaseTaps[i];
+							}
+						}
+						// Normalize each phase to unity gain, so a constant input comes out at the same level whatever the phase.
+						for (std::size_t i = 0; i < phaseTaps.size(); i++)
+						{
+							taps[i] = float(phaseTaps[i] / tapSum);
+						}
+					}
+
+					// Pad the input with silence on both sides so every output sample can read a full window.
+					std::vector<float> paddedInput((halfTapCount - 1) + sampleCountIn + tapCount + 1, 0.0f);
+					for (std::size_t i = 0; i < sampleCountIn; i++)
+					{
+						paddedInput[(halfTapCount - 1) + i] = samplesIn[i];
+					}
+
+					std::size_t outputCount = std::size_t(((unsigned long long)(sampleCountIn) * upFactor + downFactor - 1) / downFactor);
+					samplesOut.resize(outputCount);
+					float (*dotProduct)(const float*, const float*, std::size_t) = (cpuSupportsAVX2()) ? dotProductAVX2 : dotProductScalar;
+					for (std::size_t i = 0; i < outputCount; i++)
+					{
+						unsigned long long inputPosition = (unsigned long long)(i) * downFactor;
+						std::size_t baseSample = std::size_t(inputPosition / upFactor);
+						unsigned long long phase = ((inputPosition % upFactor) * phaseCount + (upFactor / 2)) / upFactor;
+						if (phase >= phaseCount)
+						{
+							phase = 0;
+							baseSample++;
+						}
+						float sample = dotProduct(paddedInput.data() + baseSample, filterBank.data() + (phase * tapCount), tapCount);
+						sample = std::min<float>(std::max<float>(std::nearbyint(sample), SHRT_MIN), SHRT_MAX);
+						samplesOut[i] = signed short(sample);
+					}
+				}
+			}
+
+			return result;
+		}
+
+		bool decodeGCADPCM(const unsigned char* dataIn, std::size_t dataLengthIn, const std::array<unsigned short, 0x10>& coefficientsIn,
+			unsigned long startSampleIn, unsigned long sampleCountIn, signed short& hist1InOut, signed short& hist2InOut, signed short* samplesOut)
+		{
+			bool result = 0;
+
+			std::size_t frameIndex = startSampleIn / _GC_ADPCM_SAMPLES_PER_FRAME;
+			std::size_t endSample = std::size_t(startSampleIn) + sampleCountIn;
+			std::size_t requiredFrames = (endSample + _GC_ADPCM_SAMPLES_PER_FRAME - 1) / _GC_ADPCM_SAMPLES_PER_FRAME;
+			// The final frame may be cut short, so only require the bytes which actually hold the requested samples.
+			std::size_t requiredLength = (requiredFrames - 1) * _GC_ADPCM_FRAME_LENGTH + 1 + (((endSample - 1) % _GC_ADPCM_SAMPLES_PER_FRAME) + 2) / 2;
+			if (dataIn != nullptr && (sampleCountIn == 0 || requiredLength <= dataLengthIn))
+			{
+				result = 1;
+
+				signed long hist1 = hist1InOut;
+				signed long hist2 = hist2InOut;
+				std::size_t frameSampleStart = startSampleIn % _GC_ADPCM_SAMPLES_PER_FRAME;
+				std::size_t samplesRemaining = sampleCountIn;
+				std::array<signed long, _GC_ADPCM_SAMPLES_PER_FRAME> scaledResiduals{};
+				while (samplesRemaining > 0)
+				{
+					const unsigned char* frame = dataIn + (frameIndex * _GC_ADPCM_FRAME_LENGTH);
+					signed long scale = 1 << (frame[0] & 0x0F);
+					unsigned long predictor = (frame[0] >> 4) & 0x07;
+					signed long coef1 = signed short(coefficientsIn[predictor * 2]);
+					signed long coef2 = signed short(coefficientsIn[(predictor * 2) + 1]);
+					std::size_t frameSampleEnd = std::min<std::size_t>(_GC_ADPCM_SAMPLES_PER_FRAME, frameSampleStart + samplesRemaining);
+
+					// Unpacking the nibbles doesn't depend on the history, so keep it in its own loop where it can be vectorized.
+					for (std::size_t i = frameSampleStart; i < frameSampleEnd; i++)
+					{
+						unsigned char currByte = frame[1 + (i / 2)];
+						signed long nibble = (i & 1) ? (currByte & 0x0F) : (currByte >> 4);
+						nibble = (nibble >= 8) ? nibble - 16 : nibble;
+						scaledResiduals[i] = (nibble * scale) << 11;
+					}
+					for (std::size_t i = frameSampleStart; i < frameSampleEnd; i++)
+					{
+						signed long sample = (scaledResiduals[i] + 1024 + (coef1 * hist1) + (coef2 * hist2)) >> 11;
+						sample = std::min<signed long>(std::max<signed long>(sample, SHRT_MIN), SHRT_MAX);
+						*samplesOut++ = signed short(sample);
+						hist2 = hist1;
+						hist1 = sample;
+					}
+
+					samplesRemaining -= frameSampleEnd - frameSampleStart;
+					frameSampleStart = 0;
+					frameIndex++;
+				}
+
+				hist1InOut = signed short(hist1);
+				hist2InOut = signed short(hist2);
+			}
+
+			return result;
+		}
+
+		gcADPCMStreamDecoder::gcADPCMStreamDecoder(const unsigned char* dataIn, std::size_t lengthIn, const std::array<unsigned short, 0x10>& coefficientsIn,
+			unsigned long sampleCountIn, signed short hist1In, signed short hist2In, unsigned long checkpointIntervalIn)
+		{
+			dataStart = dataIn;
+			dataLength = (dataIn != nullptr) ? lengthIn : 0x00;
+			coefficients = coefficientsIn;
+			sampleCount = sampleCountIn;
+			std::size_t spanNibbles = std::min<std::size_t>(dataLength, ULONG_MAX / 2) * 2;
+			spanSampleCount = std::min(sampleCount, nibblesToSamples(unsigned long(spanNibbles)));
+			checkpointInterval = std::max<unsigned long>(checkpointIntervalIn, 1);
+			hist1 = hist1In;
+			hist2 = hist2In;
+			recordCheckpoint();
+		}
+
+		void gcADPCMStreamDecoder::recordCheckpoint()
+		{
+			// Only called on frame boundaries; checkpoints are recorded in order, so the next one due is always at the back.
+			unsigned long frameIndex = position / _GC_ADPCM_SAMPLES_PER_FRAME;
+			if ((frameIndex % checkpointInterval) == 0 && (frameIndex / checkpointInterval) == checkpoints.size())
+			{
+				checkpoint newCheckpoint;
+				newCheckpoint.frameIndex = frameIndex;
+				newCheckpoint.hist1 = hist1;
+				newCheckpoint.hist2 = hist2;
+				checkpoints.push_back(newCheckpoint);
+			}
+		}
+		unsigned long gcADPCMStreamDecoder::getSampleCount() const
+		{
+			return sampleCount;
+		}
+		unsigned long gcADPCMStreamDecoder::getPosition() const
+		{
+			return position;
+		}
+		bool gcADPCMStreamDecoder::atEnd() const
+		{
+			return position >= sampleCount;
+		}
+		const std::vector<gcADPCMStreamDecoder::checkpoint>& gcADPCMStreamDecoder::getCheckpoints() const
+		{
+			return checkpoints;
+		}
+		void gcADPCMStreamDecoder::getHistory(signed short& hist1Out, signed short& hist2Out) const
+		{
+			hist1Out = hist1;
+			hist2Out = hist2;
+		}
+
+		unsigned long gcADPCMStreamDecoder::read(signed short* samplesOut, unsigned long sampleCountIn)
+		{
+			unsigned long result = 0;
+
+			if (samplesOut != nullptr)
+			{
+				unsigned long samplesPerCheckpoint = checkpointInterval * _GC_ADPCM_SAMPLES_PER_FRAME;
+				unsigned long samplesRemaining = std::min(sampleCountIn, sampleCount - std::min(position, sampleCount));
+				while (samplesRemaining > 0)
+				{
+					// Decode in runs which stop at the next checkpoint, so that it can be recorded on the way past.
+					unsigned long nextCheckpointSample = ((position / samplesPerCheckpoint) + 1) * samplesPerCheckpoint;
+					unsigned long runLength = std::min(samplesRemaining, nextCheckpointSample - position);
+					if (position < spanSampleCount)
+					{
+						runLength = std::min(runLength, spanSampleCount - position);
+						decodeGCADPCM(dataStart, dataLength, coefficients, position, runLength, hist1, hist2, samplesOut);
+					}
+					else
+					{
+						// Past the end of the span, so work one frame at a time out of a zero-padded copy.
+						unsigned long frameIndex = position / _GC_ADPCM_SAMPLES_PER_FRAME;
+						unsigned long frameSampleStart = position % _GC_ADPCM_SAMPLES_PER_FRAME;
+						runLength = std::min(runLength, _GC_ADPCM_SAMPLES_PER_FRAME - frameSampleStart);
+						std::array<unsigned char, _GC_ADPCM_FRAME_LENGTH> frameBuffer{};
+						std::size_t frameAddress = std::size_t(frameIndex) * _GC_ADPCM_FRAME_LENGTH;
+						if (frameAddress < dataLength)
+						{
+							std::size_t bytesAvailable = std::min<std::size_t>(_GC_ADPCM_FRAME_LENGTH, dataLength - frameAddress);
+							std::copy(dataStart + frameAddress, dataStart + frameAddress + bytesAvailable, frameBuffer.begin());
+						}
+						decodeGCADPCM(frameBuffer.data(), frameBuffer.size(), coefficients, frameSampleStart, runLength, hist1, hist2, samplesOut);
+					}
+
+					samplesOut += runLength;
+					samplesRemaining -= runLength;
+					position += runLength;
+					result += runLength;
+					if ((position % _GC_ADPCM_SAMPLES_PER_FRAME) == 0)
+					{
+						recordCheckpoint();
+					}
+				}
+			}
+
+			return result;
+		}
+		unsigned long gcADPCMStreamDecoder::read(std::vector<signed short>& samplesOut, unsigned long sampleCountIn)
+		{
+			samplesOut.resize(std::min(sampleCountIn, sampleCount - std::min(position, sampleCount)));
+			unsigned long result = read(samplesOut.data(), unsigned long(samplesOut.size()));
+			samplesOut.resize(result);
+			return result;
+		}
+		bool gcADPCMStreamDecoder::seek(unsigned long sampleIn)
+		{
+			bool result = 0;
+
+			if (sampleIn <= sampleCount)
+			{
+				result = 1;
+
+				unsigned long targetFrame = sampleIn / _GC_ADPCM_SAMPLES_PER_FRAME;
+				const checkpoint* nearestCheckpoint = &checkpoints[std::min<std::size_t>(targetFrame / checkpointInterval, checkpoints.size() - 1)];
+				// If we're already between that checkpoint and the target, carrying on from here is cheaper.
+				unsigned long nearestSample = nearestCheckpoint->frameIndex * _GC_ADPCM_SAMPLES_PER_FRAME;
+				if (position > sampleIn || position < nearestSample)
+				{
+					position = nearestSample;
+					hist1 = nearestCheckpoint->hist1;
+					hist2 = nearestCheckpoint->hist2;
+				}
+
+				// Decoded samples are discarded here, so only the history matters.
+				std::array<signed short, _GC_ADPCM_SAMPLES_PER_FRAME * 0x10> discardBuffer{};
+				while (position < sampleIn)
+				{
+					read(discardBuffer.data(), std::min<unsigned long>(unsigned long(discardBuffer.size()), sampleIn - position));
+				}
+			}
+
+			return result;
+		}
+		void gcADPCMStreamDecoder::buildCheckpoints()
+		{
+			unsigned long originalPosition = position;
+			unsigned long lastCheckpointFrame = (sampleCount > 0) ? (sampleCount - 1) / _GC_ADPCM_SAMPLES_PER_FRAME : 0x00;
+			seek(std::min(sampleCount, (lastCheckpointFrame / checkpointInterval) * checkpointInterval * _GC_ADPCM_SAMPLES_PER_FRAME));
+			seek(originalPosition);
+		}
+		unsigned long wav::sampleCount() const
+		{
+			return (channels.empty()) ? 0x00 : unsigned long(channels.front().size());
+		}
+		unsigned long wav::size() const
+		{
+			unsigned long result = 0x0C;
+
+			result += 0x08 + 0x10; // fmt
+			if (looped)
+			{
+				result += 0x08 + 0x24 + 0x18; // smpl, with one loop
+			}
+			result += 0x08 + (sampleCount() * unsigned long(channels.size()) * sizeof(signed short)); // data
+
+			return result;
+		}
+		bool wav::populate(const byteArray& bodyIn, unsigned long addressIn)
+		{
+			bool result = 0;
+
+			// RIFF chunk IDs are read as big-endian tags, everything else in a WAV is little-endian.
+			if (bodyIn.populated() && (std::size_t(addressIn) + 0x0C) <= bodyIn.size()
+				&& bodyIn.getLong(addressIn) == 0x52494646 && bodyIn.getLong(addressIn + 0x08) == 0x57415645) // RIFF, WAVE
+			{
+				std::size_t riffEnd = std::min<std::size_t>(bodyIn.size(), std::size_t(addressIn) + 0x08 + bodyIn.getLong(addressIn + 0x04, nullptr, endType::et_LITTLE_ENDIAN));
+				unsigned short formatTag = 0x00;
+				unsigned short channelCount = 0x00;
+				unsigned short bitsPerSample = 0x00;
+				unsigned long sampleRateIn = 0x00;
+				std::size_t dataAddress = SIZE_MAX;
+				std::size_t dataLength = 0x00;
+				bool loopFound = 0;
+				unsigned long loopStartIn = 0x00;
+				unsigned long loopEndIn = 0x00;
+
+				// Walk the chunk list; anything other than fmt, smpl, and data is skipped.
+				std::size_t cursor = std::size_t(addressIn) + 0x0C;
+				while ((cursor + 0x08) <= riffEnd)
+				{
+					unsigned long chunkTag = bodyIn.getLong(cursor);
+					std::size_t chunkLength = bodyIn.getLong(cursor + 0x04, nullptr, endType::et_LITTLE_ENDIAN);
+					std::size_t chunkBodyAddress = cursor + 0x08;
+					chunkLength = std::min(chunkLength, riffEnd - chunkBodyAddress);
+					if (chunkTag == 0x666D7420 && chunkLength >= 0x10) // fmt
+					{
+						formatTag = bodyIn.getShort(chunkBodyAddress, nullptr, endType::et_LITTLE_ENDIAN);
+						channelCount = bodyIn.getShort(chunkBodyAddress + 0x02, nullptr, endType::et_LITTLE_ENDIAN);
+						sampleRateIn = bodyIn.getLong(chunkBodyAddress + 0x04, nullptr, endType::et_LITTLE_ENDIAN);
+						bitsPerSample = bodyIn.getShort(chunkBodyAddress + 0x0E, nullptr, endType::et_LITTLE_ENDIAN);
+						// WAVE_FORMAT_EXTENSIBLE keeps the real format tag at the start of its SubFormat GUID.
+						if (formatTag == 0xFFFE && chunkLength >= 0x28)
+						{
+							formatTag = bodyIn.getShort(chunkBodyAddress + 0x18, nullptr, endType::et_LITTLE_ENDIAN);
+						}
+					}
+					else if (chunkTag == 0x736D706C && chunkLength >= 0x24 + 0x18) // smpl
+					{
+						if (bodyIn.getLong(chunkBodyAddress + 0x1C, nullptr, endType::et_LITTLE_ENDIAN) > 0)
+						{
+							loopFound = 1;
+							loopStartIn = bodyIn.getLong(chunkBodyAddress + 0x24 + 0x08, nullptr, endType::et_LITTLE_ENDIAN);
+							loopEndIn = bodyIn.getLong(chunkBodyAddress + 0x24 + 0x0C, nullptr, endType::et_LITTLE_ENDIAN);
+						}
+					}
+					else if (chunkTag == 0x64617461) // data
+					{
+						dataAddress = chunkBodyAddress;
+						dataLength = chunkLength;
+					}
+					// Chunks are padded to an even length.
+					cursor = chunkBodyAddress + chunkLength + (chunkLength & 1);
+				}
+
+				if (formatTag != 0x01 || (bitsPerSample != 0x08 && bitsPerSample != 0x10))
+				{
+					std::cerr << "[ERROR] Unsupported WAV format; only 8 and 16-bit PCM are supported.\n";
+				}
+				else if (channelCount > 0 && dataAddress != SIZE_MAX)
+				{
+					std::size_t bytesPerSample = bitsPerSample / 8;
+					std::size_t sampleCountIn = dataLength / (bytesPerSample * channelCount);
+					const unsigned char* dataPtr = (const unsigned char*)bodyIn.data() + dataAddress;
+					channels.assign(channelCount, std::vector<signed short>(sampleCountIn));
+					for (std::size_t i = 0; i < sampleCountIn; i++)
+					{
+						for (std::size_t u = 0; u < channelCount; u++)
+						{
+							if (bytesPerSample == 1)
+							{
+								// 8-bit WAV samples are unsigned, centered on 0x80.
+								channels[u][i] = signed short((signed short(*dataPtr) - 0x80) << 0x08);
+							}
+							else
+							{
+								channels[u][i] = signed short(dataPtr[0] | (dataPtr[1] << 0x08));
+							}
+							dataPtr += bytesPerSample;
+						}
+					}
+					sampleRate = sampleRateIn;
+					looped = loopFound && loopStartIn <= loopEndIn && loopEndIn < sampleCountIn;
+					loopStartSample = (looped) ? loopStartIn : 0x00;
+					loopEndSample = (looped) ? loopEndIn : 0x00;
+					result = 1;
+				}
+			}
+
+			return result;
+		}
+		bool wav::populate(std::istream& sourceStream)
+		{
+			bool result = 0;
+
+			if (sourceStream.good())
+			{
+				byteArray tempArr(sourceStream);
+				result = populate(tempArr, 0x00);
+			}
+
+			return result;
+		}
+		bool wav::populate(std::string pathIn)
+		{
+			bool result = 0;
+
+			std::ifstream wavInput(pathIn, std::ios_base::in | std::ios_base::binary);
+			if (wavInput.is_open())
+			{
+				result = populate(wavInput);
+				if (!result)
+				{
+					std::cerr << "[ERROR] Unable to read \"" << pathIn << "\" as a WAV!\n";
+				}
+			}
+
+			return result;
+		}
+		bool wav::exportContents(std::ostream& destinationStream) const
+		{
+			bool result = 0;
+
+			if (destinationStream.good() && !channels.empty() && channels.size() <= USHRT_MAX)
+			{
+				std::size_t samplesPerChannel = channels.front().size();
+				result = 1;
+				for (std::size_t i = 1; result && i < channels.size(); i++)
+				{
+					result = channels[i].size() == samplesPerChannel;
+				}
+				if (result)
+				{
+					unsigned short channelCount = unsigned short(channels.size());
+					unsigned short blockAlign = channelCount * sizeof(signed short);
+					unsigned long dataLength = unsigned long(samplesPerChannel * blockAlign);
+
+					// Chunk tags are written big-endian so they come out in reading order.
+					writeRawDataToStream(destinationStream, unsigned long(0x52494646)); // RIFF
+					writeRawDataToStream(destinationStream, unsigned long(size() - 0x08), endType::et_LITTLE_ENDIAN);
+					writeRawDataToStream(destinationStream, unsigned long(0x57415645)); // WAVE
+					writeRawDataToStream(destinationStream, unsigned long(0x666D7420)); // fmt
+					writeRawDataToStream(destinationStream, unsigned long(0x10), endType::et_LITTLE_ENDIAN);
+					writeRawDataToStream(destinationStream, unsigned short(0x01), endType::et_LITTLE_ENDIAN); // PCM
+					writeRawDataToStream(destinationStream, channelCount, endType::et_LITTLE_ENDIAN);
+					writeRawDataToStream(destinationStream, sampleRate, endType::et_LITTLE_ENDIAN);
+					writeRawDataToStream(destinationStream, unsigned long(sampleRate * blockAlign), endType::et_LITTLE_ENDIAN);
+					writeRawDataToStream(destinationStream, blockAlign, endType::et_LITTLE_ENDIAN);
+					writeRawDataToStream(destinationStream, unsigned short(0x10), endType::et_LITTLE_ENDIAN); // Bits per Sample
+					if (looped)
+					{
+						writeRawDataToStream(destinationStream, unsigned long(0x736D706C)); // smpl
+						writeRawDataToStream(destinationStream, unsigned long(0x24 + 0x18), endType::et_LITTLE_ENDIAN);
+						writeRawDataToStream(destinationStream, unsigned long(0x00), endType::et_LITTLE_ENDIAN); // Manufacturer
+						writeRawDataToStream(destinationStream, unsigned long(0x00), endType::et_LITTLE_ENDIAN); // Product
+						writeRawDataToStream(destinationStream, unsigned long((sampleRate > 0) ? 1000000000 / sampleRate : 0), endType::et_LITTLE_ENDIAN); // Sample Period (ns)
+						writeRawDataToStream(destinationStream, unsigned long(0x3C), endType::et_LITTLE_ENDIAN); // MIDI Unity Note (Middle C)
+						writeRawDataToStream(destinationStream, unsigned long(0x00), endType::et_LITTLE_ENDIAN); // MIDI Pitch Fraction
+						writeRawDataToStream(destinationStream, unsigned long(0x00), endType::et_LITTLE_ENDIAN); // SMPTE Format
+						writeRawDataToStream(destinationStream, unsigned long(0x00), endType::et_LITTLE_ENDIAN); // SMPTE Offset
+						writeRawDataToStream(destinationStream, unsigned long(0x01), endType::et_LITTLE_ENDIAN); // Loop Count
+						writeRawDataToStream(destinationStream, unsigned long(0x00), endType::et_LITTLE_ENDIAN); // Sampler Data Length
+						writeRawDataToStream(destinationStream, unsigned long(0x00), endType::et_LITTLE_ENDIAN); // Cue Point ID
+						writeRawDataToStream(destinationStream, unsigned long(0x00), endType::et_LITTLE_ENDIAN); // Loop Type (Forward)
+						writeRawDataToStream(destinationStream, loopStartSample, endType::et_LITTLE_ENDIAN);
+						writeRawDataToStream(destinationStream, loopEndSample, endType::et_LITTLE_ENDIAN);
+						writeRawDataToStream(destinationStream, unsigned long(0x00), endType::et_LITTLE_ENDIAN); // Fraction
+						writeRawDataToStream(destinationStream, unsigned long(0x00), endType::et_LITTLE_ENDIAN); // Play Count (Infinite)
+					}
+					writeRawDataToStream(destinationStream, unsigned long(0x64617461)); // data
+					writeRawDataToStream(destinationStream, dataLength, endType::et_LITTLE_ENDIAN);
+
+					std::vector<unsigned char> interleavedSamples(dataLength);
+					unsigned char* cursor = interleavedSamples.data();
+					for (std::size_t i = 0; i < samplesPerChannel; i++)
+					{
+						for (std::size_t u = 0; u < channels.size(); u++)
+						{
+							unsigned short currSample = unsigned short(channels[u][i]);
+							*cursor++ = currSample & 0xFF;
+							*cursor++ = currSample >> 0x08;
+						}
+					}
+					destinationStream.write((const char*)interleavedSamples.data(), interleavedSamples.size());
+					result = destinationStream.good();
+				}
+			}
+
+			return result;
+		}
+		bool wav::exportContents(std::string pathIn) const
+		{
+			bool result = 0;
+
+			std::ofstream wavOutput(pathIn, std::ios_base::out | std::ios_base::binary);
+			if (wavOutput.is_open())
+			{
+				result = exportContents(wavOutput);
+			}
+
+			return result;
+		}
+		std::vector<unsigned char> wav::contentsToVec() const
+		{
+			std::vector<unsigned char> result;
+
+			std::stringstream tempStream(std::ios_base::in | std::ios_base::out | std::ios_base::binary);
+			if (exportContents(tempStream))
+			{
+				result = streamContentsToVec(tempStream);
+			}
+
+			return result;
+		}
+		bool wav::encodeToDSPs(std::vector<dsp>& dspsOut, unsigned char encodeModeIn, unsigned long targetSampleRateIn, unsigned long threadCount,
+			std::vector<gcADPCMEncodeReport>* reportsOut) const
+		{
+			bool result = 0;
+
+			if (!channels.empty() && sampleCount() > 0 && sampleRate != ULONG_MAX && sampleRate != 0)
+			{
+				unsigned long outputRate = (targetSampleRateIn != 0) ? targetSampleRateIn : sampleRate;
+				unsigned long outputSampleCount = unsigned long(((unsigned long long)(sampleCount()) * outputRate + sampleRate - 1) / sampleRate);
+				unsigned long outputLoopStart = std::min(rescaleSampleIndex(loopStartSample, sampleRate, outputRate), outputSampleCount - 1);
+				unsigned long outputLoopEnd = std::min(rescaleSampleIndex(loopEndSample, sampleRate, outputRate), outputSampleCount - 1);
+				unsigned long encodedSampleCount = (looped) ? outputLoopEnd + 1 : outputSampleCount;
+
+				// Channels are encoded in parallel; any threads left over go to each channel's own coefficient and frame search.
+				unsigned long availableThreads = (threadCount != 0) ? threadCount : getDefaultThreadCount();
+				unsigned long threadsPerChannel = std::max<unsigned long>(1, availableThreads / unsigned long(channels.size()));
+				std::vector<gcADPCMEncodeReport> channelReports(channels.size());
+				std::vector<char> channelsEncoded(channels.size(), 0);
+				dspsOut.assign(channels.size(), dsp());
+				lava::parallelFor(channels.size(), [&](std::size_t i)
+				{
+					std::vector<signed short> channelSamples{};
+					if (resamplePCM(channels[i].data(), channels[i].size(), sampleRate, outputRate, channelSamples))
+					{
+						channelSamples.resize(encodedSampleCount);
+						channelsEncoded[i] = dspsOut[i].populateFromPCM(channelSamples, outputRate, encodeModeIn, threadsPerChannel, &channelReports[i]);
+						if (channelsEncoded[i] && looped)
+						{
+							dspsOut[i].loops = 1;
+							dspsOut[i].loopStart = sampleToNibbleAddress(outputLoopStart);
+							dspsOut[i].loopEnd = sampleToNibbleAddress(encodedSampleCount - 1);
+							channelsEncoded[i] = dspsOut[i].updateLoopContext();
+						}
+					}
+				}, availableThreads);
+
+				result = std::find(channelsEncoded.begin(), channelsEncoded.end(), 0) == channelsEncoded.end();
+				if (reportsOut != nullptr)
+				{
+					*reportsOut = channelReports;
+				}
+			}
+
+			return result;
+		}
+
 		bool channelInfo::populate(const lava::byteArray& bodyIn, unsigned long addressIn)
 		{
 			bool result = 0;
@@ -178,6 +1454,130 @@ namespace lava
 
 			return result;
 		}
+		bool dsp::populateFromPCM(const std::vector<signed short>& samplesIn, unsigned long sampleRateIn, unsigned char encodeModeIn, unsigned long threadCount, gcADPCMEncodeReport* reportOut)
+		{
+			bool result = 0;
+
+			if (!samplesIn.empty() && samplesIn.size() <= ULONG_MAX)
+			{
+				std::array<unsigned short, 0x10> coefficients{};
+				calculateGCADPCMCoefficients(samplesIn.data(), samplesIn.size(), coefficients, threadCount);
+				if (encodeGCADPCM(samplesIn.data(), samplesIn.size(), coefficients, body, encodeModeIn, threadCount))
+				{
+					sampleCount = unsigned long(samplesIn.size());
+					nibbleCount = samplesToNibbles(sampleCount);
+					sampleRate = sampleRateIn;
+					loops = 0x00;
+					loopStart = sampleToNibbleAddress(0);
+					loopEnd = sampleToNibbleAddress(sampleCount - 1);
+
+					soundInfo.coefficients = coefficients;
+					soundInfo.gain = 0x00;
+					soundInfo.ps = body.front();
+					soundInfo.yn1 = 0x00;
+					soundInfo.yn2 = 0x00;
+					soundInfo.lps = 0x00;
+					soundInfo.lyn1 = 0x00;
+					soundInfo.lyn2 = 0x00;
+					result = 1;
+
+					if (reportOut != nullptr)
+					{
+						std::vector<signed short> decodedSamples{};
+						result = decodeToPCM(decodedSamples);
+						double signalEnergy = 0.0;
+						double noiseEnergy = 0.0;
+						unsigned long peakError = 0x00;
+						for (std::size_t i = 0; result && i < samplesIn.size(); i++)
+						{
+							signed long error = signed long(samplesIn[i]) - signed long(decodedSamples[i]);
+							signalEnergy += double(samplesIn[i]) * samplesIn[i];
+							noiseEnergy += double(error) * error;
+							peakError = std::max(peakError, unsigned long(std::abs(error)));
+						}
+						reportOut->sampleCount = sampleCount;
+						reportOut->peakError = peakError;
+						// A perfect encode has no noise at all, so report that as infinite rather than dividing by zero.
+						reportOut->signalToNoiseRatio = (noiseEnergy > 0.0) ? 10.0 * std::log10(signalEnergy / noiseEnergy) : HUGE_VAL;
+					}
+				}
+			}
+
+			return result;
+		}
+		bool dsp::decodeToPCM(std::vector<signed short>& samplesOut) const
+		{
+			bool result = 0;
+
+			if (sampleCount != ULONG_MAX)
+			{
+				samplesOut.resize(sampleCount);
+				signed short hist1 = signed short(soundInfo.yn1);
+				signed short hist2 = signed short(soundInfo.yn2);
+				result = decodeGCADPCM(body.data(), body.size(), soundInfo.coefficients, 0, sampleCount, hist1, hist2, samplesOut.data());
+			}
+
+			return result;
+		}
+		bool dsp::decodeLoopToPCM(std::vector<signed short>& samplesOut) const
+		{
+			bool result = 0;
+
+			// Loop points are stored as nibble offsets.
+			unsigned long loopStartSample = nibblesToSamples(loopStart);
+			if (loops && sampleCount != ULONG_MAX && loopStartSample < sampleCount)
+			{
+				samplesOut.resize(sampleCount - loopStartSample);
+				signed short hist1 = signed short(soundInfo.lyn1);
+				signed short hist2 = signed short(soundInfo.lyn2);
+				result = decodeGCADPCM(body.data(), body.size(), soundInfo.coefficients, loopStartSample, samplesOut.size(), hist1, hist2, samplesOut.data());
+			}
+
+			return result;
+		}
+		bool dsp::getLoopContext(unsigned short& lpsOut, unsigned short& lyn1Out, unsigned short& lyn2Out) const
+		{
+			bool result = 0;
+
+			// Loop points are stored as nibble offsets.
+			unsigned long loopStartSample = nibblesToSamples(loopStart);
+			std::size_t loopFrameAddress = std::size_t(loopStartSample / _GC_ADPCM_SAMPLES_PER_FRAME) * _GC_ADPCM_FRAME_LENGTH;
+			if (loops && sampleCount != ULONG_MAX && loopStartSample < sampleCount && loopFrameAddress < body.size())
+			{
+				// Only the history matters, so the decoder is just run forward to the loop start and nothing past it gets decoded.
+				gcADPCMStreamDecoder loopDecoder(body.data(), body.size(), soundInfo.coefficients, sampleCount, signed short(soundInfo.yn1), signed short(soundInfo.yn2));
+				result = loopDecoder.seek(loopStartSample);
+				if (result)
+				{
+					signed short hist1 = 0x00;
+					signed short hist2 = 0x00;
+					loopDecoder.getHistory(hist1, hist2);
+					lpsOut = body[loopFrameAddress];
+					lyn1Out = unsigned short(hist1);
+					lyn2Out = unsigned short(hist2);
+				}
+			}
+
+			return result;
+		}
+		bool dsp::updateLoopContext()
+		{
+			bool result = 0;
+
+			if (loops)
+			{
+				result = getLoopContext(soundInfo.lps, soundInfo.lyn1, soundInfo.lyn2);
+			}
+			else
+			{
+				soundInfo.lps = 0x00;
+				soundInfo.lyn1 = 0x00;
+				soundInfo.lyn2 = 0x00;
+				result = 1;
+			}
+
+			return result;
+		}
 
 		bool spt::populate(const byteArray& bodyIn, unsigned long addressIn)
 		{
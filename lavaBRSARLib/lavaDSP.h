@@ -3,7 +3,12 @@
 
 #include <string>
 #include <array>
+#include <vector>
+#include <fstream>
+#include <cmath>
+#include <cfloat>
 #include "lavaByteArray.h"
+#include "lavaUtility.h"
 
 namespace lava
 {
@@ -15,6 +20,96 @@ namespace lava
 		unsigned long nibblesToBytes(unsigned long nibblesIn);
 		unsigned long samplesToNibbles(unsigned long samplesIn);
 		unsigned long samplesToBytes(unsigned long samplesIn);
+		// Converts a sample index into the nibble address DSP headers use for loop points, which skips over each frame's header byte.
+		unsigned long sampleToNibbleAddress(unsigned long sampleIn);
+
+		constexpr unsigned long _GC_ADPCM_FRAME_LENGTH = 0x08;
+		constexpr unsigned long _GC_ADPCM_SAMPLES_PER_FRAME = 0x0E;
+		// Decodes sampleCountIn samples of GC-ADPCM, beginning at startSampleIn (which needn't be frame-aligned).
+		// hist1InOut and hist2InOut must hold the two samples which precede the start sample, and are left holding the last two decoded.
+		// Returns false if the requested samples run past the end of the data.
+		bool decodeGCADPCM(const unsigned char* dataIn, std::size_t dataLengthIn, const std::array<unsigned short, 0x10>& coefficientsIn,
+			unsigned long startSampleIn, unsigned long sampleCountIn, signed short& hist1InOut, signed short& hist2InOut, signed short* samplesOut);
+
+		// Decodes a GC-ADPCM channel a block at a time, straight from a byte span which must outlive the decoder.
+		// History carries over between reads, so consecutive reads produce exactly what one full decode would.
+		// Every checkpointIntervalIn frames, the history going into that frame is recorded, so seeking only has to decode forward
+		// from the nearest checkpoint. Checkpoints are recorded as decoding passes them, or all at once with buildCheckpoints().
+		// Samples whose bytes fall past the end of the span decode as if those bytes were zero.
+		struct gcADPCMStreamDecoder
+		{
+			struct checkpoint
+			{
+				unsigned long frameIndex = 0x00;
+				signed short hist1 = 0x00;
+				signed short hist2 = 0x00;
+			};
+
+		private:
+			const unsigned char* dataStart = nullptr;
+			std::size_t dataLength = 0x00;
+			std::array<unsigned short, 0x10> coefficients{};
+			unsigned long sampleCount = 0x00;
+			// The number of samples whose bytes are entirely within the span.
+			unsigned long spanSampleCount = 0x00;
+			unsigned long checkpointInterval = 0x100;
+			std::vector<checkpoint> checkpoints{};
+
+			unsigned long position = 0x00;
+			signed short hist1 = 0x00;
+			signed short hist2 = 0x00;
+
+			void recordCheckpoint();
+		public:
+
+			gcADPCMStreamDecoder(const unsigned char* dataIn = nullptr, std::size_t lengthIn = 0x00, const std::array<unsigned short, 0x10>& coefficientsIn = {},
+				unsigned long sampleCountIn = 0x00, signed short hist1In = 0x00, signed short hist2In = 0x00, unsigned long checkpointIntervalIn = 0x100);
+
+			unsigned long getSampleCount() const;
+			unsigned long getPosition() const;
+			bool atEnd() const;
+			const std::vector<checkpoint>& getCheckpoints() const;
+			// The last two samples decoded, which are what the next sample is predicted from.
+			void getHistory(signed short& hist1Out, signed short& hist2Out) const;
+
+			// Decodes up to sampleCountIn samples from the current position, and returns how many were decoded.
+			unsigned long read(signed short* samplesOut, unsigned long sampleCountIn);
+			unsigned long read(std::vector<signed short>& samplesOut, unsigned long sampleCountIn);
+			// Moves to the given sample, decoding forward from the nearest checkpoint at or before it. Fails if it's past the end.
+			bool seek(unsigned long sampleIn);
+			// Decodes the whole channel once to record every checkpoint, then returns to the current position.
+			void buildCheckpoints();
+		};
+
+		enum gcADPCMEncodeModes
+		{
+			// Follows VGAudio's encoder: every predictor is fully searched, and frames are encoded in order.
+			gaem_COMPATIBLE = 0x00,
+			// Only fully searches the two predictors which best fit each frame, and encodes long waves in independent parallel segments.
+			gaem_FAST,
+		};
+		struct gcADPCMEncodeReport
+		{
+			unsigned long sampleCount = 0x00;
+			// In decibels, measured by decoding the result and comparing it against the input.
+			double signalToNoiseRatio = 0.0;
+			unsigned long peakError = 0x00;
+		};
+		// Calculates the 8 predictor coefficient pairs best suited to the given PCM. Ported from DSPCorrelateCoefs by way of VGAudio.
+		// Frames are analyzed across threadCount threads; the result doesn't depend on the thread count.
+		void calculateGCADPCMCoefficients(const signed short* samplesIn, std::size_t sampleCountIn, std::array<unsigned short, 0x10>& coefficientsOut, unsigned long threadCount = 0);
+		// Encodes PCM to GC-ADPCM using the given coefficients, starting from zeroed history.
+		bool encodeGCADPCM(const signed short* samplesIn, std::size_t sampleCountIn, const std::array<unsigned short, 0x10>& coefficientsIn,
+			std::vector<unsigned char>& dataOut, unsigned char encodeModeIn = gcADPCMEncodeModes::gaem_COMPATIBLE, unsigned long threadCount = 0);
+
+		// Converts PCM between sample rates using a Kaiser-windowed sinc filter, evaluated as a polyphase filter bank.
+		// When downsampling, the cutoff drops to just under the new Nyquist rate so nothing above it aliases back in.
+		// The inner loop runs on AVX2 where the CPU supports it; both paths sum in the same order, so their output is identical.
+		bool resamplePCM(const signed short* samplesIn, std::size_t sampleCountIn, unsigned long sourceRateIn, unsigned long targetRateIn,
+			std::vector<signed short>& samplesOut);
+		// Maps a sample index at one rate onto the nearest sample index at another.
+		unsigned long rescaleSampleIndex(unsigned long sampleIn, unsigned long sourceRateIn, unsigned long targetRateIn);
+		bool cpuSupportsAVX2();
 
 		struct channelInfo
 		{
@@ -102,6 +197,18 @@ namespace lava
 			bool populate(const byteArray& bodyIn, unsigned long addressIn);
 			bool populate(std::string pathIn, unsigned long addressIn);
 			bool exportContents(std::ostream& destinationStream) const;
+
+			// Encodes the given samples as a non-looping DSP, calculating fresh coefficients for them.
+			bool populateFromPCM(const std::vector<signed short>& samplesIn, unsigned long sampleRateIn, unsigned char encodeModeIn = gcADPCMEncodeModes::gaem_COMPATIBLE,
+				unsigned long threadCount = 0, gcADPCMEncodeReport* reportOut = nullptr);
+			// Decodes the whole body, starting from the initial history in soundInfo.
+			bool decodeToPCM(std::vector<signed short>& samplesOut) const;
+			// Decodes from the loop start through to the end, using the loop context in soundInfo instead of decoding everything before it.
+			bool decodeLoopToPCM(std::vector<signed short>& samplesOut) const;
+			// Works out the loop context (the predictor/scale byte and history at the loop start) by decoding up to the loop start.
+			bool getLoopContext(unsigned short& lpsOut, unsigned short& lyn1Out, unsigned short& lyn2Out) const;
+			// Sets soundInfo's loop context from getLoopContext(), or zeroes it if the DSP doesn't loop.
+			bool updateLoopContext();
 		};
 		struct spt
 		{
@@ -118,6 +225,38 @@ namespace lava
 		};
 
 		dsp sptToDSPHeader(const spt& sptIn);
+
+		/*
+		RIFF WAVE Structure, only covering what's needed to move PCM in and out of wave packets.
+		- fmt and data are required; a smpl chunk's first loop, if present, becomes the wave's loop points.
+		- Reads 8 or 16-bit PCM (including WAVE_FORMAT_EXTENSIBLE), always writes 16-bit PCM.
+		- Everything works on buffers and streams, so nothing touches the filesystem unless a path is passed in.
+		*/
+		struct wav
+		{
+			unsigned long sampleRate = ULONG_MAX;
+			bool looped = 0;
+			// Both inclusive, in samples.
+			unsigned long loopStartSample = 0x00;
+			unsigned long loopEndSample = 0x00;
+			// One vector per channel; they're interleaved on output, and must all be the same length.
+			std::vector<std::vector<signed short>> channels{};
+
+			unsigned long sampleCount() const;
+			unsigned long size() const;
+
+			bool populate(const byteArray& bodyIn, unsigned long addressIn);
+			bool populate(std::istream& sourceStream);
+			bool populate(std::string pathIn);
+			bool exportContents(std::ostream& destinationStream) const;
+			bool exportContents(std::string pathIn) const;
+			std::vector<unsigned char> contentsToVec() const;
+
+			// Encodes each channel to its own DSP, first resampling to targetSampleRateIn if it's set and differs from sampleRate.
+			// Loop points are rescaled to match, and anything past the loop end is dropped, since waves always loop through to their end.
+			bool encodeToDSPs(std::vector<dsp>& dspsOut, unsigned char encodeModeIn = gcADPCMEncodeModes::gaem_COMPATIBLE, unsigned long targetSampleRateIn = 0,
+				unsigned long threadCount = 0, std::vector<gcADPCMEncodeReport>* reportsOut = nullptr) const;
+		};
 	}
 }
 
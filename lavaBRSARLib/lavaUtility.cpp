@@ -143,8 +143,10 @@ namespace lava
 		std::string temp = "";
 		if (byteLevel == CHAR_MAX)
 		{
-			byteLevel = log2(bytesIn) / 10;
+			// log2 is undefined for anything below 1, so those are just reported in bytes.
+			byteLevel = (bytesIn > 0) ? char(log2(bytesIn) / 10) : char(byteLevels::BYT);
 		}
+		byteLevel = std::min<char>(std::max<char>(byteLevel, byteLevels::BYT), byteLevels::_count - 1);
 		temp = lava::doubleToStringWithPadding(bytesToHigherBytes(std::max(0ll, bytesIn - 1), byteLevel), 0x02) + " ";
 		if (abbrv)
 		{
@@ -157,4 +159,13 @@ namespace lava
 		return temp;
 	}
 
-}
\ No newline at end of file
+	unsigned long getDefaultThreadCount()
+	{
+		unsigned long result = std::thread::hardware_concurrency();
+		if (result == 0)
+		{
+			result = 1;
+		}
+		return result;
+	}
+}
@@ -5,6 +5,11 @@
 #include <vector>
 #include <cctype>
 #include <sstream>
+#include <thread>
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <condition_variable>
 
 namespace lava
 {
@@ -31,6 +36,113 @@ namespace lava
 		_count
 	};
 	std::string bytesToFileSizeString(long long int bytesIn, char byteLevel = CHAR_MAX, bool abbrv = 0);
+
+	unsigned long getDefaultThreadCount();
+	// Calls funcIn(i) for every i in [0, countIn), spread across up to threadCountIn threads (0 uses getDefaultThreadCount()).
+	// Indices are handed out one at a time, so uneven workloads still balance; funcIn must be safe to call concurrently.
+	template<typename funcType>
+	void parallelFor(std::size_t countIn, funcType funcIn, unsigned long threadCountIn = 0)
+	{
+		if (threadCountIn == 0)
+		{
+			threadCountIn = getDefaultThreadCount();
+		}
+		if (threadCountIn > countIn)
+		{
+			threadCountIn = (unsigned long)countIn;
+		}
+
+		if (threadCountIn <= 1)
+		{
+			for (std::size_t i = 0; i < countIn; i++)
+			{
+				funcIn(i);
+			}
+		}
+		else
+		{
+			std::atomic<std::size_t> nextIndex(0);
+			auto workerFunc = [&nextIndex, &funcIn, countIn]()
+			{
+				for (std::size_t i = nextIndex++; i < countIn; i = nextIndex++)
+				{
+					funcIn(i);
+				}
+			};
+			std::vector<std::thread> workerThreads{};
+			for (unsigned long i = 1; i < threadCountIn; i++)
+			{
+				workerThreads.emplace_back(workerFunc);
+			}
+			workerFunc();
+			for (std::size_t i = 0; i < workerThreads.size(); i++)
+			{
+				workerThreads[i].join();
+			}
+		}
+	}
+
+	// A fixed-capacity FIFO for handing work between threads. push() blocks while the queue is full, which
+	// keeps a fast producer from running arbitrarily far ahead of its consumers; pop() blocks while it's empty.
+	template<typename itemType>
+	struct boundedQueue
+	{
+	private:
+		std::deque<itemType> items{};
+		std::size_t capacity = 1;
+		bool closed = 0;
+		std::mutex queueMutex;
+		std::condition_variable notFull;
+		std::condition_variable notEmpty;
+	public:
+		boundedQueue(std::size_t capacityIn) : capacity((capacityIn > 0) ? capacityIn : 1) {}
+
+		// Returns false if the queue was closed, in which case the item is discarded.
+		bool push(itemType itemIn)
+		{
+			bool result = 0;
+
+			std::unique_lock<std::mutex> queueLock(queueMutex);
+			notFull.wait(queueLock, [this]() { return closed || items.size() < capacity; });
+			if (!closed)
+			{
+				items.push_back(std::move(itemIn));
+				result = 1;
+				queueLock.unlock();
+				notEmpty.notify_one();
+			}
+
+			return result;
+		}
+		// Returns false once the queue is closed and every remaining item has been taken.
+		bool pop(itemType& itemOut)
+		{
+			bool result = 0;
+
+			std::unique_lock<std::mutex> queueLock(queueMutex);
+			notEmpty.wait(queueLock, [this]() { return closed || !items.empty(); });
+			if (!items.empty())
+			{
+				itemOut = std::move(items.front());
+				items.pop_front();
+				result = 1;
+				queueLock.unlock();
+				notFull.notify_one();
+			}
+
+			return result;
+		}
+		// Signals that nothing more will be pushed. Items already queued can still be popped.
+		void close()
+		{
+			{
+				std::lock_guard<std::mutex> queueLock(queueMutex);
+				closed = 1;
+			}
+			notFull.notify_all();
+			notEmpty.notify_all();
+		}
+	};
 }
 
-#endif
\ No newline at end of file
+#endif
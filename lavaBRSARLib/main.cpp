@@ -61,7 +61,7 @@ constexpr bool ENABLE_MULTI_PUSH_RWSD_WAV_ENTRY_TEST = false;
 constexpr bool ENABLE_FILL_RWSD_WITH_WAV_TEST = false;
 // Fills all WAVE entries with a given WAV
 constexpr bool ENABLE_CUT_DOWN_RWSD_TEST = false;
-// Tests lossiness of the dsp-to-wav conversion process
+// Tests lossiness of repeatedly round-tripping a DSP through a wave. For codec loss across a WAV corpus, see lavaBRSARLibBench.
 constexpr bool ENABLE_CONV_LOSS_TEST = false;
 // Tests lavaByteArray's Operations for errors.
 constexpr bool ENABLE_BYTE_ARRAY_TEST = false;
@@ -264,50 +264,26 @@ int main()
 	}
 	if (ENABLE_MULTI_WAVE_INFO_TO_WAV_TEST)
 	{
+		std::vector<std::pair<unsigned long, std::string>> fileIDsToOutputDirs{};
 		for (unsigned long u = multiWaveExportTestInitialGroupID; u < multiWaveExportTestInitialGroupID + multiWaveExportTestGroupsCound; u++)
 		{
-			lava::brawl::rwsd testExportRWSD;
 			lava::brawl::brsarInfoGroupHeader* currGroupHead = testBrsar.infoSection.getGroupWithID(u);
 			if (currGroupHead != nullptr)
 			{
 				std::string targetDirectory = multiWaveExportOutputDIrectory + "Group_" + lava::numToDecStringWithPadding(u, 3) + "/";
 				for (unsigned long y = 0; y < currGroupHead->entries.size(); y++)
 				{
-					lava::brawl::brsarInfoGroupEntry* currFile = &currGroupHead->entries[y];
-					lava::brawl::brsarInfoFileHeader* relevantFileHeader = testBrsar.infoSection.getFileHeaderPointer(currFile->fileID);
-					lava::brawl::brsarFileFileContents* currFileContents = &relevantFileHeader->fileContents;
-					if (currFileContents->header.size() >= 4)
+					lava::brawl::brsarInfoFileHeader* relevantFileHeader = testBrsar.infoSection.getFileHeaderPointer(currGroupHead->entries[y].fileID);
+					if (relevantFileHeader != nullptr && relevantFileHeader->fileContents.getFileType() == lava::brawl::brsarHexTags::bht_RWSD)
 					{
-						if (lava::bytesToFundamental<unsigned int>(currFileContents->header.data()) == lava::brawl::brsarHexTags::bht_RWSD)
-						{
-							if (testExportRWSD.populate(*currFileContents))
-							{
-								if (std::filesystem::create_directories(targetDirectory) || std::filesystem::is_directory(targetDirectory))
-								{
-									for (unsigned long i = 0; i < testExportRWSD.waveSection.entries.size(); i++)
-									{
-										std::string targetFile = "file_" + lava::numToDecStringWithPadding(currFile->fileID, 3) + "_wav_" + lava::numToDecStringWithPadding(i, 3) + ".wav";
-										std::cout << "Exporting " << targetDirectory + targetFile << "... ";
-										if (testExportRWSD.exportWaveRawDataToWAV(i, targetDirectory + targetFile))
-										{
-											std::cout << "Success!\n";
-										}
-										else
-										{
-											std::cerr << "Failure!\n";
-										}
-									}
-								}
-								else
-								{
-									std::cerr << "Unable to create output folder (\"" << targetDirectory << "\"), make sure it's a valid location.\n";
-								}
-							}
-						}
+						fileIDsToOutputDirs.push_back(std::make_pair(currGroupHead->entries[y].fileID, targetDirectory));
 					}
 				}
 			}
 		}
+		lava::brawl::brsarWaveExportStats exportStats;
+		testBrsar.exportWAVs(fileIDsToOutputDirs, 0, &exportStats);
+		std::cout << "Exported " << exportStats.wavesExported << " waves (" << exportStats.wavesPerSecond() << " per second), " << exportStats.wavesFailed << " failures.\n";
 	}
 	if (ENABLE_WAV_TO_WAVE_INFO_TEST)
 	{
@@ -317,8 +293,14 @@ int main()
 		{
 			if (tempRWSD.populate(relevantFileHeader->fileContents))
 			{
-				if (tempRWSD.overwriteWaveRawDataWithWAV(dspTestImportWaveIndex, dspTestFileName + ".wav"))
+				std::vector<lava::brawl::gcADPCMEncodeReport> encodeReports{};
+				if (tempRWSD.overwriteWaveRawDataWithWAV(dspTestImportWaveIndex, dspTestFileName + ".wav", 0, lava::brawl::gcADPCMEncodeModes::gaem_COMPATIBLE, 0, &encodeReports))
 				{
+					for (std::size_t i = 0; i < encodeReports.size(); i++)
+					{
+						std::cout << "Encoded Channel " << i << ": SNR " << lava::doubleToStringWithPadding(encodeReports[i].signalToNoiseRatio, 0, 2)
+							<< "dB, Peak Error " << encodeReports[i].peakError << "\n";
+					}
 					if (testBrsar.overwriteFile(tempRWSD.fileSectionToVec(), tempRWSD.rawDataSectionToVec(), dspTestTargetFileID))
 					{
 						testBrsar.exportContents(targetBrsarName + "_wav.brsar");
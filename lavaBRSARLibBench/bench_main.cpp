@@ -0,0 +1,544 @@
+#include "../lavaBRSARLib/lavaByteArray.h"
+#include "../lavaBRSARLib/lavaBRSARLib.h"
+#include "../lavaBRSARLib/lavaDSP.h"
+#include "../lavaBRSARLib/lavaUtility.h"
+#include <chrono>
+#include <map>
+#include <iomanip>
+
+// Bench Constants
+const std::string benchVersion = "v0.1.0";
+const std::string nullArgumentString = "-";
+const std::string defaultResultsPath = "./benchResults.csv";
+
+// Regression Thresholds
+// SNR may drop by at most this much (in dB) against the baseline before a row is flagged.
+constexpr double snrRegressionTolerance = 0.01;
+// Throughput is noisy between runs, so only flag drops larger than this fraction of the baseline.
+constexpr double throughputRegressionTolerance = 0.25;
+
+// Samples handed to the stream decoder per read() call.
+constexpr unsigned long streamDecodeBlockLength = 0x400;
+
+
+bool isNullArg(const char* argIn)
+{
+	return (argIn != nullptr) ? (strcmp(argIn, nullArgumentString.c_str()) == 0) : 0;
+}
+const std::string commentChars = "/\\#";
+bool lineIsCommented(std::string lineIn)
+{
+	bool result = 1;
+
+	if (!lineIn.empty())
+	{
+		result = commentChars.find(lineIn.front()) != std::string::npos;
+	}
+
+	return result;
+}
+bool pathIsWAV(const std::filesystem::path& pathIn)
+{
+	return std::filesystem::is_regular_file(pathIn) && lava::stringToLower(pathIn.extension().string()) == ".wav";
+}
+
+// Accepts a single WAV, a folder (searched recursively), or a text document listing one WAV path per line.
+std::vector<std::string> collectWAVPaths(std::string sourcePathIn)
+{
+	std::vector<std::string> result{};
+
+	std::filesystem::path sourcePath(sourcePathIn);
+	if (std::filesystem::is_directory(sourcePath))
+	{
+		for (const std::filesystem::directory_entry& currEntry : std::filesystem::recursive_directory_iterator(sourcePath))
+		{
+			if (pathIsWAV(currEntry.path()))
+			{
+				result.push_back(currEntry.path().string());
+			}
+		}
+		// Directory iteration order isn't specified, so sort to keep results comparable between runs.
+		std::sort(result.begin(), result.end());
+	}
+	else if (pathIsWAV(sourcePath))
+	{
+		result.push_back(sourcePathIn);
+	}
+	else if (std::filesystem::is_regular_file(sourcePath))
+	{
+		std::ifstream listIn(sourcePathIn);
+		std::string currentLine = "";
+		while (std::getline(listIn, currentLine))
+		{
+			if (!currentLine.empty() && currentLine.back() == '\r')
+			{
+				currentLine.pop_back();
+			}
+			if (!lineIsCommented(currentLine))
+			{
+				if (pathIsWAV(currentLine))
+				{
+					result.push_back(currentLine);
+				}
+				else
+				{
+					std::cerr << "[ERROR] Skipping \"" << currentLine << "\": not a WAV file.\n";
+				}
+			}
+		}
+	}
+
+	return result;
+}
+
+struct channelBenchResult
+{
+	std::string filePath = "";
+	unsigned long channelIndex = ULONG_MAX;
+	unsigned long sampleRate = ULONG_MAX;
+	unsigned long sampleCount = 0x00;
+	unsigned char encodeMode = UCHAR_MAX;
+	bool succeeded = 0;
+
+	double signalToNoiseRatio = 0.0;
+	unsigned long peakError = 0x00;
+	// Against the same channel encoded in gaem_COMPATIBLE mode, which follows VGAudio's encoder. Only meaningful for gaem_FAST rows.
+	double snrDeltaVsReference = 0.0;
+	bool bitExactWithReference = 0;
+	// Whether decoding block by block through gcADPCMStreamDecoder matched dsp::decodeToPCM().
+	bool streamDecodeMatches = 0;
+
+	double encodeSamplesPerSecond = 0.0;
+	double decodeSamplesPerSecond = 0.0;
+	double streamDecodeSamplesPerSecond = 0.0;
+	// The PCM, encoded and decoded buffers held at once while this channel is benchmarked.
+	unsigned long long peakBufferBytes = 0x00;
+
+	std::string key() const
+	{
+		return filePath + "|" + std::to_string(channelIndex) + "|" + std::to_string(encodeMode);
+	}
+};
+
+std::string encodeModeToString(unsigned char encodeModeIn)
+{
+	std::string result = "UNKNOWN";
+
+	switch (encodeModeIn)
+	{
+		case lava::brawl::gcADPCMEncodeModes::gaem_COMPATIBLE: { result = "COMPATIBLE"; break; }
+		case lava::brawl::gcADPCMEncodeModes::gaem_FAST: { result = "FAST"; break; }
+		default: { break; }
+	}
+
+	return result;
+}
+double samplesPerSecond(unsigned long sampleCountIn, std::chrono::steady_clock::duration elapsedIn)
+{
+	double seconds = std::chrono::duration<double>(elapsedIn).count();
+	return (seconds > 0.0) ? double(sampleCountIn) / seconds : 0.0;
+}
+void measureError(const std::vector<signed short>& originalIn, const std::vector<signed short>& decodedIn, double& snrOut, unsigned long& peakOut)
+{
+	double signalPower = 0.0;
+	double noisePower = 0.0;
+	peakOut = 0x00;
+	std::size_t comparedLength = std::min(originalIn.size(), decodedIn.size());
+	for (std::size_t i = 0; i < comparedLength; i++)
+	{
+		double error = double(originalIn[i]) - double(decodedIn[i]);
+		signalPower += double(originalIn[i]) * double(originalIn[i]);
+		noisePower += error * error;
+		peakOut = std::max(peakOut, unsigned long(std::abs(error)));
+	}
+	if (noisePower > 0.0)
+	{
+		snrOut = (signalPower > 0.0) ? 10.0 * std::log10(signalPower / noisePower) : -DBL_MAX;
+	}
+	else
+	{
+		// A lossless round trip; report it as the best any 16-bit signal could manage rather than infinity, so the CSV stays numeric.
+		snrOut = 20.0 * std::log10(double(SHRT_MAX) * std::sqrt(double(comparedLength)));
+	}
+}
+
+// Encodes and decodes one channel single-threaded, since files are already spread across threads.
+channelBenchResult benchmarkChannel(const std::vector<signed short>& samplesIn, unsigned long sampleRateIn, unsigned char encodeModeIn, lava::brawl::dsp& dspOut)
+{
+	channelBenchResult result;
+	result.sampleRate = sampleRateIn;
+	result.sampleCount = samplesIn.size();
+	result.encodeMode = encodeModeIn;
+
+	auto encodeStart = std::chrono::steady_clock::now();
+	bool encoded = dspOut.populateFromPCM(samplesIn, sampleRateIn, encodeModeIn, 1);
+	auto encodeEnd = std::chrono::steady_clock::now();
+	if (encoded)
+	{
+		std::vector<signed short> decodedSamples{};
+		auto decodeStart = std::chrono::steady_clock::now();
+		bool decoded = dspOut.decodeToPCM(decodedSamples);
+		auto decodeEnd = std::chrono::steady_clock::now();
+		if (decoded)
+		{
+			result.succeeded = 1;
+			result.encodeSamplesPerSecond = samplesPerSecond(dspOut.sampleCount, encodeEnd - encodeStart);
+			result.decodeSamplesPerSecond = samplesPerSecond(dspOut.sampleCount, decodeEnd - decodeStart);
+			measureError(samplesIn, decodedSamples, result.signalToNoiseRatio, result.peakError);
+
+			std::vector<signed short> streamedSamples(dspOut.sampleCount);
+			lava::brawl::gcADPCMStreamDecoder streamDecoder(dspOut.body.data(), dspOut.body.size(), dspOut.soundInfo.coefficients,
+				dspOut.sampleCount, signed short(dspOut.soundInfo.yn1), signed short(dspOut.soundInfo.yn2));
+			unsigned long streamedCount = 0x00;
+			unsigned long lastReadCount = ULONG_MAX;
+			auto streamStart = std::chrono::steady_clock::now();
+			while (!streamDecoder.atEnd() && lastReadCount > 0)
+			{
+				lastReadCount = streamDecoder.read(streamedSamples.data() + streamedCount, std::min(streamDecodeBlockLength, dspOut.sampleCount - streamedCount));
+				streamedCount += lastReadCount;
+			}
+			auto streamEnd = std::chrono::steady_clock::now();
+			result.streamDecodeSamplesPerSecond = samplesPerSecond(streamedCount, streamEnd - streamStart);
+			result.streamDecodeMatches = streamedSamples == decodedSamples;
+
+			result.peakBufferBytes = (samplesIn.size() + decodedSamples.size() + streamedSamples.size()) * sizeof(signed short) + dspOut.body.size();
+		}
+	}
+
+	return result;
+}
+std::vector<channelBenchResult> benchmarkWAV(std::string wavPathIn)
+{
+	std::vector<channelBenchResult> result{};
+
+	lava::brawl::wav sourceWAV;
+	if (sourceWAV.populate(wavPathIn))
+	{
+		const unsigned char encodeModes[] = { lava::brawl::gcADPCMEncodeModes::gaem_COMPATIBLE, lava::brawl::gcADPCMEncodeModes::gaem_FAST };
+		for (unsigned long i = 0; i < sourceWAV.channels.size(); i++)
+		{
+			lava::brawl::dsp referenceDSP;
+			for (unsigned char currMode : encodeModes)
+			{
+				lava::brawl::dsp currDSP;
+				channelBenchResult currResult = benchmarkChannel(sourceWAV.channels[i], sourceWAV.sampleRate, currMode, currDSP);
+				currResult.filePath = wavPathIn;
+				currResult.channelIndex = i;
+				if (currMode == lava::brawl::gcADPCMEncodeModes::gaem_COMPATIBLE)
+				{
+					referenceDSP = std::move(currDSP);
+				}
+				else if (currResult.succeeded && !result.empty() && result.back().succeeded)
+				{
+					currResult.snrDeltaVsReference = currResult.signalToNoiseRatio - result.back().signalToNoiseRatio;
+					currResult.bitExactWithReference = currDSP.body == referenceDSP.body && currDSP.soundInfo.coefficients == referenceDSP.soundInfo.coefficients;
+				}
+				result.push_back(currResult);
+			}
+		}
+	}
+	else
+	{
+		std::cerr << "[ERROR] Unable to parse \"" << wavPathIn << "\" as a WAV file.\n";
+	}
+
+	return result;
+}
+
+const std::string resultsCSVHeader = "file,channel,sample_rate,samples,mode,ok,snr_db,peak_error,snr_delta_vs_reference_db,bit_exact_with_reference,"
+	"stream_decode_matches,encode_samples_per_sec,decode_samples_per_sec,stream_decode_samples_per_sec,peak_buffer_bytes";
+bool exportResultsCSV(const std::vector<channelBenchResult>& resultsIn, std::string pathIn)
+{
+	bool result = 0;
+
+	std::ofstream csvOut(pathIn, std::ios_base::out);
+	if (csvOut.is_open())
+	{
+		csvOut << resultsCSVHeader << "\n";
+		csvOut << std::fixed;
+		for (const channelBenchResult& currResult : resultsIn)
+		{
+			// COMPATIBLE rows are the reference itself, so they have nothing to be bit-exact against.
+			std::string bitExactField = "";
+			if (currResult.encodeMode == lava::brawl::gcADPCMEncodeModes::gaem_FAST)
+			{
+				bitExactField = std::to_string(currResult.bitExactWithReference);
+			}
+			csvOut << "\"" << currResult.filePath << "\"," << currResult.channelIndex << "," << currResult.sampleRate << "," << currResult.sampleCount << ","
+				<< encodeModeToString(currResult.encodeMode) << "," << currResult.succeeded << ","
+				<< std::setprecision(4) << currResult.signalToNoiseRatio << "," << currResult.peakError << "," << currResult.snrDeltaVsReference << ","
+				<< bitExactField << "," << currResult.streamDecodeMatches << ","
+				<< std::setprecision(0) << currResult.encodeSamplesPerSecond << "," << currResult.decodeSamplesPerSecond << ","
+				<< currResult.streamDecodeSamplesPerSecond << "," << currResult.peakBufferBytes << "\n";
+		}
+		result = csvOut.good();
+	}
+
+	return result;
+}
+// Reads back a CSV written by exportResultsCSV(), keyed by channelBenchResult::key().
+std::map<std::string, channelBenchResult> importResultsCSV(std::string pathIn)
+{
+	std::map<std::string, channelBenchResult> result{};
+
+	std::ifstream csvIn(pathIn, std::ios_base::in);
+	std::string currentLine = "";
+	if (csvIn.is_open() && std::getline(csvIn, currentLine))
+	{
+		while (std::getline(csvIn, currentLine))
+		{
+			// The file path is the only quoted field, and always comes first.
+			std::size_t pathEnd = currentLine.find("\",");
+			if (!currentLine.empty() && currentLine.front() == '\"' && pathEnd != std::string::npos)
+			{
+				channelBenchResult currResult;
+				currResult.filePath = currentLine.substr(1, pathEnd - 1);
+
+				std::vector<std::string> fields{};
+				std::stringstream fieldStream(currentLine.substr(pathEnd + 2));
+				std::string currField = "";
+				while (std::getline(fieldStream, currField, ','))
+				{
+					fields.push_back(currField);
+				}
+				if (fields.size() == 14)
+				{
+					try
+					{
+						currResult.channelIndex = std::stoul(fields[0]);
+						currResult.sampleRate = std::stoul(fields[1]);
+						currResult.sampleCount = std::stoul(fields[2]);
+						currResult.encodeMode = (fields[3] == "FAST") ? lava::brawl::gcADPCMEncodeModes::gaem_FAST : lava::brawl::gcADPCMEncodeModes::gaem_COMPATIBLE;
+						currResult.succeeded = fields[4] == "1";
+						currResult.signalToNoiseRatio = std::stod(fields[5]);
+						currResult.peakError = std::stoul(fields[6]);
+						currResult.encodeSamplesPerSecond = std::stod(fields[10]);
+						currResult.decodeSamplesPerSecond = std::stod(fields[11]);
+						currResult.streamDecodeSamplesPerSecond = std::stod(fields[12]);
+						result[currResult.key()] = currResult;
+					}
+					catch (const std::exception&)
+					{
+						std::cerr << "[ERROR] Skipping malformed baseline row for \"" << currResult.filePath << "\" in \"" << pathIn << "\".\n";
+					}
+				}
+			}
+		}
+	}
+
+	return result;
+}
+// Prints every way the current results fall short of the baseline, and returns how many rows regressed.
+unsigned long compareAgainstBaseline(const std::vector<channelBenchResult>& resultsIn, const std::map<std::string, channelBenchResult>& baselineIn)
+{
+	unsigned long result = 0;
+
+	for (const channelBenchResult& currResult : resultsIn)
+	{
+		auto baselineItr = baselineIn.find(currResult.key());
+		if (baselineItr != baselineIn.end())
+		{
+			const channelBenchResult& baseline = baselineItr->second;
+			std::string rowName = currResult.filePath + " (Channel " + std::to_string(currResult.channelIndex) + ", " + encodeModeToString(currResult.encodeMode) + ")";
+			std::vector<std::string> problems{};
+			if (baseline.succeeded && !currResult.succeeded)
+			{
+				problems.push_back("round trip failed");
+			}
+			else if (currResult.succeeded)
+			{
+				if (currResult.signalToNoiseRatio < baseline.signalToNoiseRatio - snrRegressionTolerance)
+				{
+					problems.push_back("SNR " + lava::doubleToStringWithPadding(baseline.signalToNoiseRatio, 0, 4) + "dB -> " + lava::doubleToStringWithPadding(currResult.signalToNoiseRatio, 0, 4) + "dB");
+				}
+				if (currResult.peakError > baseline.peakError)
+				{
+					problems.push_back("peak error " + std::to_string(baseline.peakError) + " -> " + std::to_string(currResult.peakError));
+				}
+				const double throughputFloor = 1.0 - throughputRegressionTolerance;
+				if (currResult.encodeSamplesPerSecond < baseline.encodeSamplesPerSecond * throughputFloor)
+				{
+					problems.push_back("encode speed " + lava::doubleToStringWithPadding(baseline.encodeSamplesPerSecond, 0, 0) + " -> " + lava::doubleToStringWithPadding(currResult.encodeSamplesPerSecond, 0, 0) + " samples/s");
+				}
+				if (currResult.decodeSamplesPerSecond < baseline.decodeSamplesPerSecond * throughputFloor)
+				{
+					problems.push_back("decode speed " + lava::doubleToStringWithPadding(baseline.decodeSamplesPerSecond, 0, 0) + " -> " + lava::doubleToStringWithPadding(currResult.decodeSamplesPerSecond, 0, 0) + " samples/s");
+				}
+			}
+			if (!problems.empty())
+			{
+				result++;
+				std::cout << "[REGRESSION] " << rowName << ":";
+				for (std::size_t i = 0; i < problems.size(); i++)
+				{
+					std::cout << ((i == 0) ? " " : ", ") << problems[i];
+				}
+				std::cout << "\n";
+			}
+		}
+	}
+
+	return result;
+}
+void summarizeResults(const std::vector<channelBenchResult>& resultsIn)
+{
+	const unsigned char encodeModes[] = { lava::brawl::gcADPCMEncodeModes::gaem_COMPATIBLE, lava::brawl::gcADPCMEncodeModes::gaem_FAST };
+	for (unsigned char currMode : encodeModes)
+	{
+		unsigned long channelCount = 0;
+		unsigned long failedCount = 0;
+		unsigned long long totalSamples = 0;
+		double encodeSeconds = 0.0;
+		double decodeSeconds = 0.0;
+		double snrSum = 0.0;
+		double worstSNR = DBL_MAX;
+		unsigned long worstPeak = 0;
+		unsigned long long largestBuffer = 0;
+		for (const channelBenchResult& currResult : resultsIn)
+		{
+			if (currResult.encodeMode == currMode)
+			{
+				if (currResult.succeeded)
+				{
+					channelCount++;
+					totalSamples += currResult.sampleCount;
+					encodeSeconds += (currResult.encodeSamplesPerSecond > 0.0) ? currResult.sampleCount / currResult.encodeSamplesPerSecond : 0.0;
+					decodeSeconds += (currResult.decodeSamplesPerSecond > 0.0) ? currResult.sampleCount / currResult.decodeSamplesPerSecond : 0.0;
+					snrSum += currResult.signalToNoiseRatio;
+					worstSNR = std::min(worstSNR, currResult.signalToNoiseRatio);
+					worstPeak = std::max(worstPeak, currResult.peakError);
+					largestBuffer = std::max(largestBuffer, currResult.peakBufferBytes);
+				}
+				else
+				{
+					failedCount++;
+				}
+			}
+		}
+		std::cout << encodeModeToString(currMode) << ": " << channelCount << " channel(s) (" << failedCount << " failed), " << totalSamples << " samples\n";
+		if (channelCount > 0)
+		{
+			std::cout << "\tSNR: " << lava::doubleToStringWithPadding(snrSum / channelCount, 0, 2) << "dB mean, " << lava::doubleToStringWithPadding(worstSNR, 0, 2) << "dB worst\n";
+			std::cout << "\tPeak Error: " << worstPeak << "\n";
+			std::cout << "\tEncode: " << lava::doubleToStringWithPadding((encodeSeconds > 0.0) ? totalSamples / encodeSeconds : 0.0, 0, 0) << " samples/s per thread\n";
+			std::cout << "\tDecode: " << lava::doubleToStringWithPadding((decodeSeconds > 0.0) ? totalSamples / decodeSeconds : 0.0, 0, 0) << " samples/s per thread\n";
+			std::cout << "\tLargest Channel Footprint: " << lava::bytesToFileSizeString(largestBuffer) << "\n";
+		}
+	}
+}
+
+int main(int argc, char** argv)
+{
+	int result = EXIT_SUCCESS;
+
+	std::cout << "lavaBRSARLibBench (Library " << lava::brawl::version << ", Bench " << benchVersion << ")\n";
+	if (argc >= 2 && !isNullArg(argv[1]))
+	{
+		std::string resultsPath = defaultResultsPath;
+		unsigned long threadCount = 0;
+		std::string baselinePath = "";
+		if (argc >= 3 && !isNullArg(argv[2]))
+		{
+			resultsPath = argv[2];
+		}
+		if (argc >= 4 && !isNullArg(argv[3]))
+		{
+			threadCount = std::strtoul(argv[3], nullptr, 10);
+		}
+		if (argc >= 5 && !isNullArg(argv[4]))
+		{
+			baselinePath = argv[4];
+		}
+
+		std::vector<std::string> wavPaths = collectWAVPaths(argv[1]);
+		if (!wavPaths.empty())
+		{
+			if (threadCount == 0)
+			{
+				threadCount = lava::getDefaultThreadCount();
+			}
+			std::cout << "Benchmarking " << wavPaths.size() << " WAV(s) across " << threadCount << " thread(s)...\n";
+
+			std::vector<std::vector<channelBenchResult>> resultsByFile(wavPaths.size());
+			auto benchStart = std::chrono::steady_clock::now();
+			lava::parallelFor(wavPaths.size(), [&](std::size_t i)
+				{
+					resultsByFile[i] = benchmarkWAV(wavPaths[i]);
+				}, threadCount);
+			auto benchEnd = std::chrono::steady_clock::now();
+
+			std::vector<channelBenchResult> allResults{};
+			unsigned long filesFailed = 0;
+			for (std::size_t i = 0; i < resultsByFile.size(); i++)
+			{
+				filesFailed += resultsByFile[i].empty();
+				allResults.insert(allResults.end(), resultsByFile[i].begin(), resultsByFile[i].end());
+			}
+			std::cout << "Finished in " << lava::doubleToStringWithPadding(std::chrono::duration<double>(benchEnd - benchStart).count(), 0, 2) << "s";
+			std::cout << " (" << filesFailed << " file(s) couldn't be read).\n";
+			summarizeResults(allResults);
+
+			unsigned long streamMismatches = 0;
+			for (const channelBenchResult& currResult : allResults)
+			{
+				if (currResult.succeeded && !currResult.streamDecodeMatches)
+				{
+					streamMismatches++;
+					std::cerr << "[ERROR] Stream decode of " << currResult.filePath << " (Channel " << currResult.channelIndex << ") didn't match the full decode.\n";
+				}
+			}
+			if (streamMismatches > 0)
+			{
+				result = EXIT_FAILURE;
+			}
+
+			if (exportResultsCSV(allResults, resultsPath))
+			{
+				std::cout << "Results written to \"" << resultsPath << "\".\n";
+			}
+			else
+			{
+				std::cerr << "[ERROR] Unable to write results to \"" << resultsPath << "\".\n";
+				result = EXIT_FAILURE;
+			}
+
+			if (!baselinePath.empty())
+			{
+				std::map<std::string, channelBenchResult> baseline = importResultsCSV(baselinePath);
+				if (!baseline.empty())
+				{
+					unsigned long regressionCount = compareAgainstBaseline(allResults, baseline);
+					std::cout << regressionCount << " regression(s) against \"" << baselinePath << "\".\n";
+					if (regressionCount > 0)
+					{
+						result = EXIT_FAILURE;
+					}
+				}
+				else
+				{
+					std::cerr << "[ERROR] Unable to read baseline results from \"" << baselinePath << "\".\n";
+					result = EXIT_FAILURE;
+				}
+			}
+		}
+		else
+		{
+			std::cerr << "[ERROR] No WAV files found at \"" << argv[1] << "\".\n";
+			result = EXIT_FAILURE;
+		}
+	}
+	else
+	{
+		std::cout << "Encodes every channel of every WAV in a corpus to GC-ADPCM and back, once per encode mode, and reports the loss and speed of each.\n";
+		std::cout << "COMPATIBLE mode follows VGAudio's encoder, so it serves as the reference that FAST mode is compared against.\n\n";
+		std::cout << "Usage: lavaBRSARLibBench {WAV_SOURCE} {RESULTS_CSV, optional} {THREAD_COUNT, optional} {BASELINE_CSV, optional}\n";
+		std::cout << "\tWAV_SOURCE: A WAV file, a folder of WAVs (searched recursively), or a text file listing one WAV path per line.\n";
+		std::cout << "\tRESULTS_CSV: Where to write per-channel results. Defaults to \"" << defaultResultsPath << "\".\n";
+		std::cout << "\tTHREAD_COUNT: How many files to process at once. Defaults to the number of hardware threads.\n";
+		std::cout << "\tBASELINE_CSV: Results from an earlier run. Rows whose SNR, peak error or throughput got worse are reported,\n";
+		std::cout << "\t\tand the program exits with a non-zero code.\n";
+		std::cout << "Use \"" << nullArgumentString << "\" to skip an optional argument.\n";
+	}
+
+	return result;
+}
@@ -1,6 +1,7 @@
 #include "../lavaBRSARLib/lavaByteArray.h"
 #include "../lavaBRSARLib/lavaBRSARLib.h"
 #include "../lavaBRSARLib/lavaUtility.h"
+#include <chrono>
 
 // CLI Constants
 const std::string cliVersion = "v0.2.3";
@@ -180,52 +181,24 @@ bool doCreateWAVEs(lava::brawl::brsar& targetBRSAR, std::vector<unsigned long> f
 {
 	bool result = 0;
 
+	bool hollowOutNewWaves = sourceWAVEID == ULONG_MAX;
+	unsigned long sourceWAVEIndex = (hollowOutNewWaves) ? 0 : sourceWAVEID;
+
+	// Validate every file up front, then make the actual edits as a single parallel batch.
+	std::vector<unsigned long> validFileIDs{};
 	for (unsigned long i = 0; i < fileIDList.size(); i++)
 	{
-		std::cout << "Adding to: RWSD 0x" << lava::numToHexStringWithPadding(fileIDList[i], 0x03) << "...\n";
-		lava::brawl::rwsd tempRWSD;
+		std::cout << "Checking: RWSD 0x" << lava::numToHexStringWithPadding(fileIDList[i], 0x03) << "...\n";
 		lava::brawl::brsarInfoFileHeader* relevantFileHeader = targetBRSAR.infoSection.getFileHeaderPointer(fileIDList[i]);
 		if (relevantFileHeader != nullptr)
 		{
-			if (tempRWSD.populate(relevantFileHeader->fileContents))
+			// Go through the BRSAR's parse cache, so repeated IDs in the list are only parsed once.
+			const lava::brawl::rwsd* cachedRWSD = targetBRSAR.getCachedRWSD(fileIDList[i]);
+			if (cachedRWSD != nullptr && !cachedRWSD->waveSection.entries.empty())
 			{
-				bool invalidSource = 0;
-				lava::brawl::waveInfo sourceWAVEObj;
-				if (sourceWAVEID != ULONG_MAX)
+				if (sourceWAVEIndex < cachedRWSD->waveSection.entries.size())
 				{
-					if (sourceWAVEID < tempRWSD.waveSection.entries.size())
-					{
-						sourceWAVEObj = tempRWSD.waveSection.entries[sourceWAVEID];
-					}
-					else
-					{
-						invalidSource = 1;
-					}
-				}
-				else
-				{
-					sourceWAVEObj = tempRWSD.waveSection.entries[0];
-					sourceWAVEObj.hollowOut();
-				}
-
-				if (!invalidSource)
-				{
-					if (tempRWSD.createNewWaveEntries(sourceWAVEObj, cloneCount, 0))
-					{
-						if (targetBRSAR.overwriteFile(tempRWSD.fileSectionToVec(), tempRWSD.rawDataSectionToVec(), fileIDList[i]))
-						{
-							result = 1;
-							std::cout << "[SUCCESS] Modified and reimported RWSD!\n";
-						}
-						else
-						{
-							std::cerr << "[ERROR] Failed while writing edited RWSD back into BRSAR!\n";
-						}
-					}
-					else
-					{
-						std::cerr << "[ERROR] Failed while cloning WAVE entry!\n";
-					}
+					validFileIDs.push_back(fileIDList[i]);
 				}
 				else
 				{
@@ -233,8 +206,8 @@ bool doCreateWAVEs(lava::brawl::brsar& targetBRSAR, std::vector<unsigned long> f
 						lava::numToDecStringWithPadding(sourceWAVEID, 0) <<
 						" (0x" << lava::numToHexStringWithPadding(sourceWAVEID, 2) << ")!\n";
 					std::cerr << "\tHighest WAVE ID in the file is " <<
-						lava::numToDecStringWithPadding(tempRWSD.waveSection.entries.size(), 0) <<
-						" (0x" << lava::numToHexStringWithPadding(tempRWSD.waveSection.entries.size(), 2) << ")!\n";
+						lava::numToDecStringWithPadding(cachedRWSD->waveSection.entries.size(), 0) <<
+						" (0x" << lava::numToHexStringWithPadding(cachedRWSD->waveSection.entries.size(), 2) << ")!\n";
 				}
 			}
 			else
@@ -248,51 +221,82 @@ bool doCreateWAVEs(lava::brawl::brsar& targetBRSAR, std::vector<unsigned long> f
 		}
 	}
 
+	if (!validFileIDs.empty())
+	{
+		std::cout << "Adding to " << validFileIDs.size() << " RWSD(s)...\n";
+		std::vector<char> succeeded{};
+		// The batch is all-or-nothing, so if any file fails, none of them are modified.
+		result = targetBRSAR.batchAppendWaves(validFileIDs, sourceWAVEIndex, cloneCount, hollowOutNewWaves, 0, &succeeded);
+		for (std::size_t i = 0; i < validFileIDs.size(); i++)
+		{
+			if (!succeeded[i])
+			{
+				std::cerr << "[ERROR] Failed while cloning WAVE entry in RWSD 0x" << lava::numToHexStringWithPadding(validFileIDs[i], 0x03) << "!\n";
+			}
+			else if (result)
+			{
+				std::cout << "[SUCCESS] Modified RWSD 0x" << lava::numToHexStringWithPadding(validFileIDs[i], 0x03) << "!\n";
+			}
+		}
+		if (!result)
+		{
+			std::cerr << "[ERROR] No RWSDs were modified.\n";
+		}
+	}
+
 	return result;
 }
 bool doDeleteWAVEs(lava::brawl::brsar& targetBRSAR, std::vector<unsigned long> fileIDList, unsigned long remainingWAVEEntriesIn, bool zeroOutRemainingEntries)
 {
 	bool result = 0;
 
+	// Validate every file up front, then make the actual edits as a single parallel batch.
+	std::vector<unsigned long> validFileIDs{};
 	for (std::size_t i = 0; i < fileIDList.size(); i++)
 	{
-		std::cout << "Removing from: RWSD 0x" << lava::numToHexStringWithPadding(fileIDList[i], 0x03) << "...\n";
-		lava::brawl::rwsd tempRWSD;
+		std::cout << "Checking: RWSD 0x" << lava::numToHexStringWithPadding(fileIDList[i], 0x03) << "...\n";
 		lava::brawl::brsarInfoFileHeader* relevantFileHeader = targetBRSAR.infoSection.getFileHeaderPointer(fileIDList[i]);
 		if (relevantFileHeader != nullptr)
 		{
-			if (tempRWSD.populate(relevantFileHeader->fileContents))
+			// Go through the BRSAR's parse cache, so repeated IDs in the list are only parsed once.
+			const lava::brawl::rwsd* cachedRWSD = targetBRSAR.getCachedRWSD(fileIDList[i]);
+			if (cachedRWSD != nullptr)
 			{
 				unsigned long remainingWAVEEntries = remainingWAVEEntriesIn;
 				if (remainingWAVEEntries == 0)
 				{
-					remainingWAVEEntries = tempRWSD.waveSection.entries.size();
+					remainingWAVEEntries = cachedRWSD->waveSection.entries.size();
 				}
-				if (remainingWAVEEntries <= tempRWSD.waveSection.entries.size())
+				// Removed WAVE entries can't still be in use; report any DATA entries which would be left pointing at one.
+				std::vector<unsigned long> blockingDataEntries{};
+				for (std::size_t u = 0; u < cachedRWSD->dataSection.entries.size(); u++)
 				{
-					if (tempRWSD.cutDownWaveSection(remainingWAVEEntries, zeroOutRemainingEntries))
-					{
-						if (targetBRSAR.overwriteFile(tempRWSD.fileSectionToVec(), tempRWSD.rawDataSectionToVec(), fileIDList[i]))
-						{
-							result = 1;
-							std::cout << "[SUCCESS] Modified and reimported RWSD!\n";
-						}
-						else
-						{
-							std::cerr << "[ERROR] Failed while writing edited RWSD back into BRSAR!\n";
-						}
-					}
-					else
+					unsigned long currWaveIndex = cachedRWSD->dataSection.entries[u].ntWaveIndex;
+					if (currWaveIndex != ULONG_MAX && currWaveIndex >= remainingWAVEEntries)
 					{
-						std::cerr << "[ERROR] Failed while removing from RWSD!\n";
+						blockingDataEntries.push_back(u);
 					}
 				}
-				else
+				if (remainingWAVEEntries > cachedRWSD->waveSection.entries.size())
 				{
 					std::cerr << "[ERROR] Unable to reduce RWSD down to "
 						<< lava::numToDecStringWithPadding(remainingWAVEEntries, 0) << " WAVE entries:\n";
 					std::cerr << "\tThere are only "
-						<< lava::numToDecStringWithPadding(tempRWSD.waveSection.entries.size(), 0) << " entries in the RWSD.\n";
+						<< lava::numToDecStringWithPadding(cachedRWSD->waveSection.entries.size(), 0) << " entries in the RWSD.\n";
+				}
+				else if (!blockingDataEntries.empty())
+				{
+					std::cerr << "[ERROR] Unable to reduce RWSD down to "
+						<< lava::numToDecStringWithPadding(remainingWAVEEntries, 0) << " WAVE entries:\n";
+					for (std::size_t u = 0; u < blockingDataEntries.size(); u++)
+					{
+						std::cerr << "\tDATA entry 0x" << lava::numToHexStringWithPadding(blockingDataEntries[u], 0x02) << " still uses WAVE entry 0x"
+							<< lava::numToHexStringWithPadding(cachedRWSD->dataSection.entries[blockingDataEntries[u]].ntWaveIndex, 0x02) << ".\n";
+					}
+				}
+				else
+				{
+					validFileIDs.push_back(fileIDList[i]);
 				}
 			}
 			else
@@ -306,6 +310,31 @@ bool doDeleteWAVEs(lava::brawl::brsar& targetBRSAR, std::vector<unsigned long> f
 		}
 	}
 
+	if (!validFileIDs.empty())
+	{
+		std::cout << "Removing from " << validFileIDs.size() << " RWSD(s)...\n";
+		// Truncating to more entries than a file has leaves its count as is, which is what a count of 0 asks for.
+		unsigned long remainingWAVEEntries = (remainingWAVEEntriesIn == 0) ? ULONG_MAX : remainingWAVEEntriesIn;
+		std::vector<char> succeeded{};
+		// The batch is all-or-nothing, so if any file fails, none of them are modified.
+		result = targetBRSAR.batchTruncateWaves(validFileIDs, remainingWAVEEntries, zeroOutRemainingEntries, 0, &succeeded);
+		for (std::size_t i = 0; i < validFileIDs.size(); i++)
+		{
+			if (!succeeded[i])
+			{
+				std::cerr << "[ERROR] Failed while removing from RWSD 0x" << lava::numToHexStringWithPadding(validFileIDs[i], 0x03) << "!\n";
+			}
+			else if (result)
+			{
+				std::cout << "[SUCCESS] Modified RWSD 0x" << lava::numToHexStringWithPadding(validFileIDs[i], 0x03) << "!\n";
+			}
+		}
+		if (!result)
+		{
+			std::cerr << "[ERROR] No RWSDs were modified.\n";
+		}
+	}
+
 	return result;
 }
 bool exportFiles(lava::brawl::brsar& targetBRSAR, std::vector<unsigned long> fileIDList, std::string exportDir, bool joinHeaderAndData)
@@ -315,9 +344,14 @@ bool exportFiles(lava::brawl::brsar& targetBRSAR, std::vector<unsigned long> fil
 	if (std::filesystem::is_directory(exportDir))
 	{
 		std::size_t successes = 0;
+		std::vector<unsigned long> summaryFileIDs{};
+		std::vector<std::string> summaryPaths{};
+		// Only used for RSEQs, which get a disassembly alongside their summary.
+		std::vector<std::string> disassemblyPaths{};
 		for (std::size_t i = 0; i < fileIDList.size(); i++)
 		{
 			std::cout << "Exporting File 0x" << lava::numToHexStringWithPadding(fileIDList[i], 0x03) << "...\n";
+			targetBRSAR.flushRWSDCacheEntry(fileIDList[i]);
 			lava::brawl::brsarInfoFileHeader* relevantFileHeader = targetBRSAR.infoSection.getFileHeaderPointer(fileIDList[i]);
 			if (relevantFileHeader != nullptr)
 			{
@@ -360,20 +394,13 @@ bool exportFiles(lava::brawl::brsar& targetBRSAR, std::vector<unsigned long> fil
 					}
 					successes += !eitherFailed;
 				}
-				if (relevantFileHeader->fileContents.getFileType() == lava::brawl::brsarHexTags::bht_RWSD)
+				if (relevantFileHeader->fileContents.getFileType() == lava::brawl::brsarHexTags::bht_RWSD
+					|| relevantFileHeader->fileContents.getFileType() == lava::brawl::brsarHexTags::bht_RBNK
+					|| relevantFileHeader->fileContents.getFileType() == lava::brawl::brsarHexTags::bht_RSEQ)
 				{
-					lava::brawl::rwsd tempRWSD;
-					if (tempRWSD.populate(relevantFileHeader->fileContents))
-					{
-						if (tempRWSD.summarize(exportDir + baseFilename + "_meta.txt"))
-						{
-							std::cerr << "[SUCCESS] Produced RWSD summary!\n";
-						}
-						else
-						{
-							std::cerr << "[ERROR] Unable to produce RWSD summary!\n";
-						}
-					}
+					summaryFileIDs.push_back(fileIDList[i]);
+					summaryPaths.push_back(exportDir + baseFilename + "_meta.txt");
+					disassemblyPaths.push_back(exportDir + baseFilename + "_disasm.txt");
 				}
 			}
 			else
@@ -381,6 +408,57 @@ bool exportFiles(lava::brawl::brsar& targetBRSAR, std::vector<unsigned long> fil
 				std::cerr << "[ERROR] Invalid File ID Specified!\n";
 			}
 		}
+
+		if (!summaryFileIDs.empty())
+		{
+			std::cout << "Summarizing " << summaryFileIDs.size() << " RWSD/RBNK/RSEQ(s)...\n";
+			std::vector<char> summarized(summaryFileIDs.size(), 0);
+			// RWSDs go through the BRSAR's parse cache, which isn't thread-safe, so they're summarized up front.
+			for (std::size_t i = 0; i < summaryFileIDs.size(); i++)
+			{
+				if (targetBRSAR.infoSection.getFileHeaderPointer(summaryFileIDs[i])->fileContents.getFileType() == lava::brawl::brsarHexTags::bht_RWSD)
+				{
+					lava::brawl::rwsd* cachedRWSD = targetBRSAR.getCachedRWSD(summaryFileIDs[i]);
+					if (cachedRWSD != nullptr)
+					{
+						summarized[i] = cachedRWSD->summarize(summaryPaths[i]);
+					}
+				}
+			}
+			// The other summaries are independent of one another, so produce them in parallel.
+			lava::parallelFor(summaryFileIDs.size(), [&](std::size_t i)
+			{
+				const lava::brawl::brsarFileFileContents* summaryContents = &targetBRSAR.infoSection.getFileHeaderPointer(summaryFileIDs[i])->fileContents;
+				if (summaryContents->getFileType() == lava::brawl::brsarHexTags::bht_RBNK)
+				{
+					lava::brawl::rbnk tempRBNK;
+					if (tempRBNK.populate(*summaryContents))
+					{
+						summarized[i] = tempRBNK.summarize(summaryPaths[i]);
+					}
+				}
+				else if (summaryContents->getFileType() == lava::brawl::brsarHexTags::bht_RSEQ)
+				{
+					lava::brawl::rseq tempRSEQ;
+					if (tempRSEQ.populate(*summaryContents))
+					{
+						summarized[i] = tempRSEQ.summarize(summaryPaths[i]) && tempRSEQ.disassemble(disassemblyPaths[i]);
+					}
+				}
+			});
+			for (std::size_t i = 0; i < summaryFileIDs.size(); i++)
+			{
+				std::string fileTypeString = targetBRSAR.infoSection.getFileHeaderPointer(summaryFileIDs[i])->fileContents.getFileTypeString();
+				if (summarized[i])
+				{
+					std::cout << "[SUCCESS] Produced " << fileTypeString << " 0x" << lava::numToHexStringWithPadding(summaryFileIDs[i], 0x03) << " summary!\n";
+				}
+				else
+				{
+					std::cerr << "[ERROR] Unable to produce " << fileTypeString << " 0x" << lava::numToHexStringWithPadding(summaryFileIDs[i], 0x03) << " summary!\n";
+				}
+			}
+		}
 		result = successes == fileIDList.size();
 	}
 	else
@@ -635,7 +713,7 @@ int main(int argc, char** argv)
 
 				std::vector<unsigned long> fileIDList = handleLiteralNumvsNumListPathOverload(argv[3]);
 
-				unsigned char cloneCount = (unsigned char)stringToNum(argv[4], 0, UCHAR_MAX);
+				unsigned long cloneCount = stringToNum(argv[4], 0, UCHAR_MAX);
 
 				unsigned long sourceWaveID = ULONG_MAX;
 				if (argProvided(5))
@@ -724,6 +802,125 @@ int main(int argc, char** argv)
 				}
 				return 0;
 			}
+			else if (strcmp("verify", argv[1]) == 0 && argc >= 3)
+			{
+				std::cout << "Operation: Verify Subfile Round Trips\n";
+				bool result = 0;
+				lava::brawl::brsar sourceBrsar;
+				std::string targetBRSARPath = argv[2];
+
+				if (std::filesystem::exists(targetBRSARPath))
+				{
+					if (sourceBrsar.init(targetBRSARPath))
+					{
+						std::vector<lava::brawl::brsarRoundTripResult> roundTripResults{};
+						auto startTime = std::chrono::steady_clock::now();
+						result = sourceBrsar.verifyRoundTrips(roundTripResults);
+						auto endTime = std::chrono::steady_clock::now();
+
+						unsigned long verifiedCount = 0;
+						unsigned long long verifiedBytes = 0;
+						unsigned long failedCount = 0;
+						for (std::size_t i = 0; i < roundTripResults.size(); i++)
+						{
+							const lava::brawl::brsarRoundTripResult* currResult = &roundTripResults[i];
+							if (currResult->supported)
+							{
+								verifiedCount++;
+								verifiedBytes += currResult->byteSize;
+								if (!currResult->matches())
+								{
+									failedCount++;
+									std::cerr << "[ERROR] File 0x" << lava::numToHexStringWithPadding(currResult->fileID, 0x03) << " ("
+										<< sourceBrsar.infoSection.fileHeaders[i]->fileContents.getFileTypeString() << "): ";
+									if (!currResult->parsed)
+									{
+										std::cerr << "Failed to parse!\n";
+									}
+									else
+									{
+										if (currResult->firstHeaderMismatch != ULONG_MAX)
+										{
+											std::cerr << "Header differs from offset 0x" << lava::numToHexStringWithPadding(currResult->firstHeaderMismatch, 0x08) << "! ";
+										}
+										if (currResult->firstDataMismatch != ULONG_MAX)
+										{
+											std::cerr << "Data differs from offset 0x" << lava::numToHexStringWithPadding(currResult->firstDataMismatch, 0x08) << "!";
+										}
+										std::cerr << "\n";
+									}
+								}
+							}
+						}
+
+						double elapsedSeconds = std::chrono::duration<double>(endTime - startTime).count();
+						std::cout << "Verified " << verifiedCount << " file(s) (" << lava::bytesToFileSizeString(verifiedBytes) << ") in "
+							<< lava::doubleToStringWithPadding(elapsedSeconds * 1000.0, 0) << "ms";
+						if (elapsedSeconds > 0.0)
+						{
+							std::cout << " (" << lava::doubleToStringWithPadding((verifiedBytes / (1024.0 * 1024.0)) / elapsedSeconds, 0) << " MB/s)";
+						}
+						std::cout << ".\n";
+						if (result)
+						{
+							std::cout << "[SUCCESS] Every file round tripped without changes!\n";
+						}
+						else
+						{
+							std::cerr << "[ERROR] " << failedCount << " file(s) failed to round trip!\n";
+						}
+					}
+					else
+					{
+						std::cerr << "Failed to initialize BRSAR!\n";
+					}
+				}
+				else
+				{
+					std::cerr << "[ERROR] Specified BRSAR (\"" << targetBRSARPath << "\") does not exist.\n";
+				}
+				// Report failure through the exit code as well, so this can be used as a build gate.
+				return (result) ? 0 : 1;
+			}
+			else if (strcmp("pruneWAVEs", argv[1]) == 0 && argc >= 3)
+			{
+				std::cout << "Operation: Prune Unreferenced WAVE Entries\n";
+				lava::brawl::brsar sourceBrsar;
+				std::string targetBRSARPath = argv[2];
+
+				if (std::filesystem::exists(targetBRSARPath))
+				{
+					if (sourceBrsar.init(targetBRSARPath))
+					{
+						unsigned long bytesReclaimed = 0x00;
+						if (sourceBrsar.removeUnreferencedWaves(0, &std::cout, &bytesReclaimed))
+						{
+							std::string exportPath = suffixFilename(targetBRSARPath, "_edit");
+							if (sourceBrsar.exportContents(exportPath))
+							{
+								std::cout << "[SUCCESS] Exported modified BRSAR to \"" << exportPath << "\"!\n";
+							}
+							else
+							{
+								std::cerr << "[ERROR] Failed to export modified BRSAR to \"" << exportPath << "\"!\n";
+							}
+						}
+						else
+						{
+							std::cerr << "[ERROR] Failed to prune WAVEs!\n";
+						}
+					}
+					else
+					{
+						std::cerr << "Failed to initialize BRSAR!\n";
+					}
+				}
+				else
+				{
+					std::cerr << "[ERROR] Specified BRSAR (\"" << targetBRSARPath << "\") does not exist.\n";
+				}
+				return 0;
+			}
 			else if (strcmp("exportFiles", argv[1]) == 0 && argc >= 4)
 			{
 				std::cout << "Operation: Export BRSAR Subfiles\n";
@@ -775,6 +972,92 @@ int main(int argc, char** argv)
 				}
 				return 0;
 			}
+			else if (strcmp("exportWAVs", argv[1]) == 0 && argc >= 4)
+			{
+				std::cout << "Operation: Export RWSD Waves to WAVs\n";
+				lava::brawl::brsar sourceBrsar;
+				std::string targetBRSARPath = argv[2];
+
+				std::vector<unsigned long> idList = handleLiteralNumvsNumListPathOverload(argv[3]);
+
+				std::string targetFolder = "./";
+				if (argProvided(4))
+				{
+					targetFolder = argv[4];
+					if (targetFolder.back() != '/' && targetFolder.back() != '\\')
+					{
+						targetFolder += "/";
+					}
+				}
+				bool idsAreGroups = 0;
+				if (argProvided(5))
+				{
+					idsAreGroups = processBoolArgument(argv[5]);
+					if (idsAreGroups)
+					{
+						std::cout << "[C.Arg] IDs will be treated as Group IDs, and each group's RWSDs will be exported to their own folder.\n";
+					}
+				}
+
+				if (std::filesystem::exists(targetBRSARPath))
+				{
+					if (sourceBrsar.init(targetBRSARPath))
+					{
+						std::vector<std::pair<unsigned long, std::string>> fileIDsToOutputDirs{};
+						for (std::size_t i = 0; i < idList.size(); i++)
+						{
+							if (idsAreGroups)
+							{
+								lava::brawl::brsarInfoGroupHeader* currGroupHead = sourceBrsar.infoSection.getGroupWithID(idList[i]);
+								if (currGroupHead != nullptr)
+								{
+									std::string groupFolder = targetFolder + "Group_" + lava::numToDecStringWithPadding(idList[i], 3) + "/";
+									for (std::size_t u = 0; u < currGroupHead->entries.size(); u++)
+									{
+										unsigned long currFileID = currGroupHead->entries[u].fileID;
+										lava::brawl::brsarInfoFileHeader* currFileHeader = sourceBrsar.infoSection.getFileHeaderPointer(currFileID);
+										if (currFileHeader != nullptr && currFileHeader->fileContents.getFileType() == lava::brawl::brsarHexTags::bht_RWSD)
+										{
+											fileIDsToOutputDirs.push_back(std::make_pair(currFileID, groupFolder));
+										}
+									}
+								}
+								else
+								{
+									std::cerr << "[WARNING] Skipping Group 0x" << lava::numToHexStringWithPadding(idList[i], 0x03) << ", it doesn't appear to exist.\n";
+								}
+							}
+							else
+							{
+								fileIDsToOutputDirs.push_back(std::make_pair(idList[i], targetFolder));
+							}
+						}
+
+						lava::brawl::brsarWaveExportStats exportStats;
+						bool exported = sourceBrsar.exportWAVs(fileIDsToOutputDirs, 0, &exportStats);
+						std::cout << "Exported " << exportStats.wavesExported << " wave(s) from " << exportStats.filesParsed << " RWSD(s) in "
+							<< lava::doubleToStringWithPadding(exportStats.secondsElapsed, 0, 2) << " second(s) ("
+							<< lava::doubleToStringWithPadding(exportStats.wavesPerSecond(), 0, 2) << " waves per second).\n";
+						if (exported)
+						{
+							std::cout << "[SUCCESS] Exported all waves to \"" << targetFolder << "\"!\n";
+						}
+						else
+						{
+							std::cerr << "[ERROR] Failed to export " << exportStats.wavesFailed << " wave(s) and " << exportStats.filesFailed << " file(s)!\n";
+						}
+					}
+					else
+					{
+						std::cerr << "Failed to initialize BRSAR!\n";
+					}
+				}
+				else
+				{
+					std::cerr << "[ERROR] Specified BRSAR (\"" << targetBRSARPath << "\") does not exist.\n";
+				}
+				return 0;
+			}
 			else if (strcmp("importFile", argv[1]) == 0 && argc >= 4)
 			{
 				std::cout << "Operation: Import BRSAR Subfile\n";
@@ -846,6 +1129,15 @@ int main(int argc, char** argv)
 			std::cout << "\tNote: Default OUTPUT_DIRECTORY is \"./\"\n";
 			std::cout << "\tNote: SPLIT_HEADERS_AND_DATA is a boolean argument, and is set to false by default.\n";
 		}
+		// ExportWAVs Info
+		{
+			std::cout << "To decode every wave in specific RWSDs to .wav files:\n";
+			std::cout << "\texportWAVs {BRSAR_PATH} {FILE_ID} {OUTPUT_DIR, optional} {IDS_ARE_GROUPS, opt}, OR\n";
+			std::cout << "\texportWAVs {BRSAR_PATH} {FILE_ID_LIST_PATH} {OUTPUT_DIR, opt} {IDS_ARE_GROUPS, opt}\n";
+			std::cout << "\tNote: Default OUTPUT_DIRECTORY is \"./\"\n";
+			std::cout << "\tNote: IDS_ARE_GROUPS is a boolean argument, and is set to false by default.\n";
+			std::cout << "\t  If set, each listed ID is a Group ID instead, and every RWSD in that group is exported to a \"Group_{ID}\" subfolder.\n";
+		}
 		// ImportFile Info
 		{
 			std::cout << "To import a specific brsar subfile to a brsar file:\n";
@@ -875,6 +1167,17 @@ int main(int argc, char** argv)
 			std::cout << "\tNote: ZERO_OUT_WAVES is a boolean argument, decides wether to zero out the audio data for remaining entries.\n";
 			std::cout << "\t  This is a boolean argument, default vaule is true.\n";
 		}
+		// Verify Info
+		{
+			std::cout << "To check that every parsed subfile in a BRSAR re-exports byte-for-byte identically:\n";
+			std::cout << "\tverify {BRSAR_PATH}\n";
+			std::cout << "\tNote: Exits with a non-zero code if any file fails to round trip.\n";
+		}
+		// PruneWAVEs Info
+		{
+			std::cout << "To remove every WAVE entry which no sound uses from every RWSD in a BRSAR:\n";
+			std::cout << "\tpruneWAVEs {BRSAR_PATH}\n";
+		}
 
 		std::cout << "Note: In any command, FILE_ID_LIST_PATH should point to a file which lists the IDs of every file to be affected.\n";
 		std::cout << "Note: To explicitly use any of the above defaults, specify \"" << nullArgumentString << "\" for that argument.\n";